@@ -2,9 +2,15 @@ import * as rl from './native/qjs-raylib.so';
 
 // Audio device management functions
 
+export const initAudioDevice = rl.initAudioDevice;
+export const closeAudioDevice = rl.closeAudioDevice;
+export const isAudioDeviceReady = rl.isAudioDeviceReady;
 
 // Wave/Sound loading/unloading functions
 
+export const loadWave = rl.loadWave;
+export const loadSound = rl.loadSound;
+export const loadSoundFromWave = rl.loadSoundFromWave;
 
 // Wave/Sound management functions
 
@@ -14,4 +20,5 @@ import * as rl from './native/qjs-raylib.so';
 
 // AudioStream management functions
 
+export const initAudioStream = rl.initAudioStream;
 
@@ -51,6 +51,10 @@ export const getFps = rl.getFps;
 export const getFrameTime = rl.getFrameTime;
 export const getTime = rl.getTime;
 
+// Main loop functions
+export const runMainLoop = rl.runMainLoop;
+export const stopMainLoop = rl.stopMainLoop;
+
 // Color-related functions
 export const colorToInt = rl.colorToInt;
 export const colorNormalize = rl.colorNormalize;
@@ -0,0 +1,238 @@
+import * as rl from './native/qjs-raylib.so';
+import { Color, DisplayList } from './native/qjs-raylib.so';
+
+// Draw list functions
+export const submitDrawList = rl.submitDrawList;
+
+// Must stay in sync with JSRLDrawOp in native/drawlist.h
+export enum DrawOp
+{
+	Clear = 1,
+	Pixel,
+	Line,
+	LineEx,
+	Circle,
+	CircleLines,
+	Rectangle,
+	RectangleLines,
+	RectanglePro,
+	RectangleGradient,
+	Triangle,
+	TriangleLines,
+	Text,
+}
+
+/**
+ * Packs a color into the 32-bit word format used by draw lists (RGBA bytes in memory order).
+ * Packing colors once up front avoids reading the Color properties on every draw.
+ */
+export function packColor(color: Color | number): number
+{
+	if (typeof color === 'number')
+		return color;
+
+	return (color.r | (color.g << 8) | (color.b << 16) | (color.a << 24)) >>> 0;
+}
+
+/**
+ * Records 2D draw commands into a binary buffer that is executed natively by a single submit() call.
+ */
+export class DrawList
+{
+	private words: Uint32Array;
+	private floats: Float32Array;
+	private strings: string[] = [];
+	private size = 0;
+
+	constructor(capacity = 4096)
+	{
+		this.words = new Uint32Array(capacity);
+		this.floats = new Float32Array(this.words.buffer);
+	}
+
+	/** Number of recorded words */
+	get length(): number
+	{
+		return this.size;
+	}
+
+	/** Recorded words, valid until the next recording call */
+	get buffer(): Uint32Array
+	{
+		return this.words.subarray(0, this.size);
+	}
+
+	clear(): void
+	{
+		this.size = 0;
+		this.strings.length = 0;
+	}
+
+	submit(): void
+	{
+		submitDrawList(this.words, this.size, this.strings);
+	}
+
+	/**
+	 * Copies the recorded commands into a display list that can be replayed every frame.
+	 * @param list Display list to re-record, a new one is created if omitted
+	 */
+	compile(list?: DisplayList): DisplayList
+	{
+		if (!list)
+			return new DisplayList(this.words, this.size, this.strings);
+
+		list.record(this.words, this.size, this.strings);
+		return list;
+	}
+
+	clearBackground(color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.Clear, 1);
+		this.words[i] = packColor(color);
+	}
+
+	pixel(x: number, y: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.Pixel, 3);
+		this.floats[i] = x;
+		this.floats[i + 1] = y;
+		this.words[i + 2] = packColor(color);
+	}
+
+	line(startX: number, startY: number, endX: number, endY: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.Line, 5);
+		this.floats[i] = startX;
+		this.floats[i + 1] = startY;
+		this.floats[i + 2] = endX;
+		this.floats[i + 3] = endY;
+		this.words[i + 4] = packColor(color);
+	}
+
+	lineEx(startX: number, startY: number, endX: number, endY: number, thick: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.LineEx, 6);
+		this.floats[i] = startX;
+		this.floats[i + 1] = startY;
+		this.floats[i + 2] = endX;
+		this.floats[i + 3] = endY;
+		this.floats[i + 4] = thick;
+		this.words[i + 5] = packColor(color);
+	}
+
+	circle(centerX: number, centerY: number, radius: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.Circle, 4);
+		this.floats[i] = centerX;
+		this.floats[i + 1] = centerY;
+		this.floats[i + 2] = radius;
+		this.words[i + 3] = packColor(color);
+	}
+
+	circleLines(centerX: number, centerY: number, radius: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.CircleLines, 4);
+		this.floats[i] = centerX;
+		this.floats[i + 1] = centerY;
+		this.floats[i + 2] = radius;
+		this.words[i + 3] = packColor(color);
+	}
+
+	rectangle(x: number, y: number, width: number, height: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.Rectangle, 5);
+		this.floats[i] = x;
+		this.floats[i + 1] = y;
+		this.floats[i + 2] = width;
+		this.floats[i + 3] = height;
+		this.words[i + 4] = packColor(color);
+	}
+
+	rectangleLines(x: number, y: number, width: number, height: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.RectangleLines, 5);
+		this.floats[i] = x;
+		this.floats[i + 1] = y;
+		this.floats[i + 2] = width;
+		this.floats[i + 3] = height;
+		this.words[i + 4] = packColor(color);
+	}
+
+	rectanglePro(x: number, y: number, width: number, height: number, originX: number, originY: number, rotation: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.RectanglePro, 8);
+		this.floats[i] = x;
+		this.floats[i + 1] = y;
+		this.floats[i + 2] = width;
+		this.floats[i + 3] = height;
+		this.floats[i + 4] = originX;
+		this.floats[i + 5] = originY;
+		this.floats[i + 6] = rotation;
+		this.words[i + 7] = packColor(color);
+	}
+
+	rectangleGradient(x: number, y: number, width: number, height: number, topLeft: Color | number, bottomLeft: Color | number, bottomRight: Color | number, topRight: Color | number): void
+	{
+		const i = this.reserve(DrawOp.RectangleGradient, 8);
+		this.floats[i] = x;
+		this.floats[i + 1] = y;
+		this.floats[i + 2] = width;
+		this.floats[i + 3] = height;
+		this.words[i + 4] = packColor(topLeft);
+		this.words[i + 5] = packColor(bottomLeft);
+		this.words[i + 6] = packColor(bottomRight);
+		this.words[i + 7] = packColor(topRight);
+	}
+
+	triangle(x1: number, y1: number, x2: number, y2: number, x3: number, y3: number, color: Color | number): void
+	{
+		this.writeTriangle(DrawOp.Triangle, x1, y1, x2, y2, x3, y3, color);
+	}
+
+	triangleLines(x1: number, y1: number, x2: number, y2: number, x3: number, y3: number, color: Color | number): void
+	{
+		this.writeTriangle(DrawOp.TriangleLines, x1, y1, x2, y2, x3, y3, color);
+	}
+
+	text(text: string, x: number, y: number, fontSize: number, color: Color | number): void
+	{
+		const i = this.reserve(DrawOp.Text, 5);
+		this.words[i] = this.strings.push(text) - 1;
+		this.floats[i + 1] = x;
+		this.floats[i + 2] = y;
+		this.floats[i + 3] = fontSize;
+		this.words[i + 4] = packColor(color);
+	}
+
+	private writeTriangle(op: DrawOp, x1: number, y1: number, x2: number, y2: number, x3: number, y3: number, color: Color | number): void
+	{
+		const i = this.reserve(op, 7);
+		this.floats[i] = x1;
+		this.floats[i + 1] = y1;
+		this.floats[i + 2] = x2;
+		this.floats[i + 3] = y2;
+		this.floats[i + 4] = x3;
+		this.floats[i + 5] = y3;
+		this.words[i + 6] = packColor(color);
+	}
+
+	// Writes the opcode and returns the index of its first argument word
+	private reserve(op: DrawOp, count: number): number
+	{
+		const needed = this.size + 1 + count;
+
+		if (needed > this.words.length)
+		{
+			const words = new Uint32Array(Math.max(needed, this.words.length * 2));
+			words.set(this.words.subarray(0, this.size));
+			this.words = words;
+			this.floats = new Float32Array(words.buffer);
+		}
+
+		this.words[this.size] = op;
+		this.size = needed;
+
+		return needed - count;
+	}
+}
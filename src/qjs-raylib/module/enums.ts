@@ -361,4 +361,24 @@ export enum NPatchType
 	NPT_9PATCH = 0,              // Npatch defined by 3x3 tiles
 	NPT_3PATCH_VERTICAL = 1,     // Npatch defined by 1x3 tiles
 	NPT_3PATCH_HORIZONTAL = 2,   // Npatch defined by 3x1 tiles
-}
\ No newline at end of file
+}
+
+export enum LineJoin
+{
+	LINE_JOIN_MITER = 0,         // Sharp corners, beveled past a 4x miter length
+	LINE_JOIN_BEVEL = 1,         // Corners cut flat
+	LINE_JOIN_ROUND = 2,         // Corners rounded with a circle
+}
+
+export enum GlyphMetric
+{
+	GLYPH_VALUE = 0,             // Unicode codepoint
+	GLYPH_OFFSET_X = 1,
+	GLYPH_OFFSET_Y = 2,
+	GLYPH_ADVANCE_X = 3,
+	GLYPH_REC_X = 4,             // Glyph rectangle in the font atlas
+	GLYPH_REC_Y = 5,
+	GLYPH_REC_WIDTH = 6,
+	GLYPH_REC_HEIGHT = 7,
+	GLYPH_STRIDE = 8,            // Floats per glyph in Font.glyphMetrics
+}
@@ -0,0 +1,184 @@
+import * as rl from './native/qjs-raylib.so';
+
+// Input snapshot functions
+export const pollInput = rl.pollInput;
+
+// Input event functions
+export const setInputEvents = rl.setInputEvents;
+export const drainInputEvents = rl.drainInputEvents;
+export const getInputEventStats = rl.getInputEventStats;
+
+// Input recording functions
+export const startInputRecording = rl.startInputRecording;
+export const stopInputRecording = rl.stopInputRecording;
+export const startInputReplay = rl.startInputReplay;
+export const stopInputReplay = rl.stopInputReplay;
+export const getInputRecordingState = rl.getInputRecordingState;
+
+// Byte offsets of the pollInput() snapshot, must stay in sync with JSRLInputState in native/input.h
+export enum InputLayout
+{
+	KEYS_DOWN = 0,               // 512 key bitset, key n at bit n % 8 of byte n / 8
+	KEYS_PRESSED = 64,
+	KEYS_RELEASED = 128,
+	KEY_PRESSED = 192,           // int32, getKeyPressed()
+	MOUSE_X = 196,               // float32
+	MOUSE_Y = 200,               // float32
+	MOUSE_WHEEL = 204,           // int32
+	MOUSE_DOWN = 208,            // uint32, bit n is mouse button n
+	MOUSE_PRESSED = 212,
+	MOUSE_RELEASED = 216,
+	TOUCH_COUNT = 220,           // int32
+	TOUCH_POINTS = 224,          // 10 x (float32 x, float32 y)
+	GESTURE = 304,               // int32, getGestureDetected()
+	GESTURE_HOLD_DURATION = 308, // float32
+	GESTURE_DRAG_VECTOR = 312,   // float32 x, float32 y
+	GESTURE_DRAG_ANGLE = 320,    // float32
+	GESTURE_PINCH_VECTOR = 324,  // float32 x, float32 y
+	GESTURE_PINCH_ANGLE = 332,   // float32
+	GAMEPAD_BUTTON_PRESSED = 336, // int32, getGamepadButtonPressed()
+	GAMEPADS = 340,              // 4 x gamepad blocks
+	GAMEPAD_SIZE = 52,
+	// Offsets inside a gamepad block
+	GAMEPAD_AVAILABLE = 0,       // uint32
+	GAMEPAD_AXIS_COUNT = 4,      // uint32
+	GAMEPAD_BUTTONS_DOWN = 8,    // uint32, bit n is button n
+	GAMEPAD_BUTTONS_PRESSED = 12,
+	GAMEPAD_BUTTONS_RELEASED = 16,
+	GAMEPAD_AXES = 20,           // 8 x float32
+	SIZE = 548,
+}
+
+/**
+ * Reads the whole input state with one pollInput() call per frame.
+ */
+export class InputState
+{
+	readonly buffer = new ArrayBuffer(InputLayout.SIZE);
+	private bytes = new Uint8Array(this.buffer);
+	private ints = new Int32Array(this.buffer);
+	private uints = new Uint32Array(this.buffer);
+	private floats = new Float32Array(this.buffer);
+
+	/** Refreshes the snapshot, call once per frame after endDrawing() */
+	poll(): this
+	{
+		rl.pollInput(this.buffer);
+		return this;
+	}
+
+	private bit(offset: number, n: number): boolean
+	{
+		return (this.bytes[offset + (n >> 3)] & (1 << (n & 7))) !== 0;
+	}
+
+	isKeyDown(key: number): boolean { return this.bit(InputLayout.KEYS_DOWN, key); }
+	isKeyPressed(key: number): boolean { return this.bit(InputLayout.KEYS_PRESSED, key); }
+	isKeyReleased(key: number): boolean { return this.bit(InputLayout.KEYS_RELEASED, key); }
+	get keyPressed(): number { return this.ints[InputLayout.KEY_PRESSED >> 2]; }
+
+	get mouseX(): number { return this.floats[InputLayout.MOUSE_X >> 2]; }
+	get mouseY(): number { return this.floats[InputLayout.MOUSE_Y >> 2]; }
+	get mouseWheel(): number { return this.ints[InputLayout.MOUSE_WHEEL >> 2]; }
+	isMouseButtonDown(button: number): boolean { return (this.uints[InputLayout.MOUSE_DOWN >> 2] & (1 << button)) !== 0; }
+	isMouseButtonPressed(button: number): boolean { return (this.uints[InputLayout.MOUSE_PRESSED >> 2] & (1 << button)) !== 0; }
+	isMouseButtonReleased(button: number): boolean { return (this.uints[InputLayout.MOUSE_RELEASED >> 2] & (1 << button)) !== 0; }
+
+	get touchCount(): number { return this.ints[InputLayout.TOUCH_COUNT >> 2]; }
+	touchX(index: number): number { return this.floats[(InputLayout.TOUCH_POINTS >> 2) + index * 2]; }
+	touchY(index: number): number { return this.floats[(InputLayout.TOUCH_POINTS >> 2) + index * 2 + 1]; }
+
+	get gesture(): number { return this.ints[InputLayout.GESTURE >> 2]; }
+	get gestureHoldDuration(): number { return this.floats[InputLayout.GESTURE_HOLD_DURATION >> 2]; }
+	get gestureDragX(): number { return this.floats[InputLayout.GESTURE_DRAG_VECTOR >> 2]; }
+	get gestureDragY(): number { return this.floats[(InputLayout.GESTURE_DRAG_VECTOR >> 2) + 1]; }
+	get gestureDragAngle(): number { return this.floats[InputLayout.GESTURE_DRAG_ANGLE >> 2]; }
+	get gesturePinchX(): number { return this.floats[InputLayout.GESTURE_PINCH_VECTOR >> 2]; }
+	get gesturePinchY(): number { return this.floats[(InputLayout.GESTURE_PINCH_VECTOR >> 2) + 1]; }
+	get gesturePinchAngle(): number { return this.floats[InputLayout.GESTURE_PINCH_ANGLE >> 2]; }
+
+	get gamepadButtonPressed(): number { return this.ints[InputLayout.GAMEPAD_BUTTON_PRESSED >> 2]; }
+
+	private gamepad(gamepad: number, field: number): number
+	{
+		return (InputLayout.GAMEPADS + gamepad * InputLayout.GAMEPAD_SIZE + field) >> 2;
+	}
+
+	isGamepadAvailable(gamepad: number): boolean { return this.uints[this.gamepad(gamepad, InputLayout.GAMEPAD_AVAILABLE)] !== 0; }
+	getGamepadAxisCount(gamepad: number): number { return this.uints[this.gamepad(gamepad, InputLayout.GAMEPAD_AXIS_COUNT)]; }
+	getGamepadAxisMovement(gamepad: number, axis: number): number { return this.floats[this.gamepad(gamepad, InputLayout.GAMEPAD_AXES) + axis]; }
+	isGamepadButtonDown(gamepad: number, button: number): boolean { return (this.uints[this.gamepad(gamepad, InputLayout.GAMEPAD_BUTTONS_DOWN)] & (1 << button)) !== 0; }
+	isGamepadButtonPressed(gamepad: number, button: number): boolean { return (this.uints[this.gamepad(gamepad, InputLayout.GAMEPAD_BUTTONS_PRESSED)] & (1 << button)) !== 0; }
+	isGamepadButtonReleased(gamepad: number, button: number): boolean { return (this.uints[this.gamepad(gamepad, InputLayout.GAMEPAD_BUTTONS_RELEASED)] & (1 << button)) !== 0; }
+}
+
+// Must stay in sync with JSRLInputEventType in native/input.h
+export enum InputEventType
+{
+	KEY_DOWN = 1,
+	KEY_UP = 2,
+	KEY_REPEAT = 3,
+	CHAR = 4,                    // code is a Unicode codepoint
+	MOUSE_MOVE = 5,              // x, y in window coordinates
+	MOUSE_DOWN = 6,              // code is the button, x, y the cursor position
+	MOUSE_UP = 7,
+	MOUSE_WHEEL = 8,             // x, y are the scroll offsets
+	GAMEPAD_DOWN = 9,            // device is the gamepad, code the button
+	GAMEPAD_UP = 10,
+	GAMEPAD_AXIS = 11,           // code is the axis, x its value
+}
+
+// Byte offsets inside an event, must stay in sync with JSRLInputEvent in native/input.h
+export enum InputEventLayout
+{
+	TIME = 0,                    // float64, seconds on the getTime() clock when the event was polled
+	TYPE = 8,                    // uint8
+	DEVICE = 9,                  // uint8
+	MODS = 10,                   // uint16, GLFW modifier bits
+	CODE = 12,                   // int32
+	X = 16,                      // float32
+	Y = 20,                      // float32
+	SIZE = 24,
+}
+
+/**
+ * Drains the native input event queue into a reusable buffer, in the order events happened.
+ */
+export class InputEvents
+{
+	readonly buffer: ArrayBuffer;
+	private times: Float64Array;
+	private bytes: Uint8Array;
+	private shorts: Uint16Array;
+	private ints: Int32Array;
+	private floats: Float32Array;
+	private count = 0;
+
+	constructor(capacity = 1024)
+	{
+		this.buffer = new ArrayBuffer(capacity * InputEventLayout.SIZE);
+		this.times = new Float64Array(this.buffer);
+		this.bytes = new Uint8Array(this.buffer);
+		this.shorts = new Uint16Array(this.buffer);
+		this.ints = new Int32Array(this.buffer);
+		this.floats = new Float32Array(this.buffer);
+	}
+
+	/** Pulls the queued events, returns how many are available */
+	drain(): number
+	{
+		this.count = rl.drainInputEvents(this.buffer);
+		return this.count;
+	}
+
+	get length(): number { return this.count; }
+
+	/** When the event was polled (once per frame, in endDrawing), not when it happened */
+	time(i: number): number { return this.times[i * 3]; }
+	type(i: number): InputEventType { return this.bytes[i * InputEventLayout.SIZE + InputEventLayout.TYPE]; }
+	device(i: number): number { return this.bytes[i * InputEventLayout.SIZE + InputEventLayout.DEVICE]; }
+	mods(i: number): number { return this.shorts[(i * InputEventLayout.SIZE + InputEventLayout.MODS) >> 1]; }
+	code(i: number): number { return this.ints[(i * InputEventLayout.SIZE + InputEventLayout.CODE) >> 2]; }
+	x(i: number): number { return this.floats[(i * InputEventLayout.SIZE + InputEventLayout.X) >> 2]; }
+	y(i: number): number { return this.floats[(i * InputEventLayout.SIZE + InputEventLayout.Y) >> 2]; }
+}
@@ -22,6 +22,7 @@ export const drawGizmo = rl.drawGizmo;
 
 // Model loading/unloading functions
 
+export const loadModel = rl.loadModel;
 
 // Mesh loading/unloading functions
 
@@ -34,6 +35,9 @@ export const drawGizmo = rl.drawGizmo;
 
 // Mesh generation functions
 
+export const genMeshPlane = rl.genMeshPlane;
+export const genMeshCube = rl.genMeshCube;
+export const genMeshSphere = rl.genMeshSphere;
 
 // Mesh manipulation functions
 
@@ -0,0 +1,14 @@
+import { Wave, Sound, AudioStream } from './qjs-raylib.so';
+
+// Audio device management functions
+export function initAudioDevice(): void;
+export function closeAudioDevice(): void;
+export function isAudioDeviceReady(): boolean;
+
+// Wave/Sound loading/unloading functions
+export function loadWave(fileName: string): Wave;
+export function loadSound(fileName: string): Sound;
+export function loadSoundFromWave(wave: Wave): Sound;
+
+// AudioStream management functions
+export function initAudioStream(sampleRate: number, sampleSize: number, channels: number): AudioStream;
@@ -56,11 +56,11 @@ export function endTextureMode(): void;
 
 // Screen-space-related functions
 /** Returns a ray trace from mouse position */
-export function getMouseRay(mousePosition: Vector2, camera: Camera2D): Ray;
+export function getMouseRay<T extends Ray | Float32Array = Ray>(mousePosition: Vector2, camera: Camera3D, out?: T, offset?: number): T;
 /** Returns the screen space position for a 3d world space position */
-export function getWorldToScreen(position: Vector3, camera: Camera2D): Vector2;
+export function getWorldToScreen<T extends Vector2 | Float32Array = Vector2>(position: Vector3, camera: Camera3D, out?: T, offset?: number): T;
 /** Returns camera transform matrix (view matrix) */
-export function getCameraMatrix(camera: Camera2D): Matrix;
+export function getCameraMatrix<T extends Matrix | Float32Array = Matrix>(camera: Camera3D, out?: T, offset?: number): T;
 
 // Timing-related functions
 /** Set target FPS (maximum) */
@@ -72,19 +72,57 @@ export function getFrameTime(): number;
 /** Returns elapsed time in seconds since InitWindow() */
 export function getTime(): number;
 
+export interface MainLoopOptions
+{
+	/** Called with fixedDt as many times as needed to catch up with real time */
+	update?: (dt: number) => void;
+	/** Called once per frame between beginDrawing() and endDrawing(), alpha is the fraction of a step left to simulate */
+	draw?: (alpha: number) => void;
+	/** Called when the frame took longer than frameBudget or update steps had to be dropped */
+	onLateFrame?: (elapsed: number, dropped: number) => void;
+	/** Simulation step in seconds, defaults to 1 / 60 */
+	fixedDt?: number;
+	/** Most update steps per frame before the backlog is dropped, defaults to 5 */
+	maxSteps?: number;
+	/** Seconds per frame spent running pending promise jobs, defaults to 0.002 */
+	jobBudget?: number;
+	/** Frames taking longer than this many seconds are reported as late, 0 (default) disables it */
+	frameBudget?: number;
+	/** Longest frame time simulated in seconds, after a stall or a jump of the clock, defaults to 0.25 */
+	maxFrameTime?: number;
+}
+
+export interface MainLoopStats
+{
+	frames: number;
+	updates: number;
+	lateFrames: number;
+	/** Simulation time skipped to catch up, in seconds */
+	droppedTime: number;
+}
+
+// Main loop functions
+/**
+ * Runs update/draw until the window should close or stopMainLoop() is called, pumping promise jobs every frame.
+ * An exception thrown by a callback or a job ends the loop and is rethrown.
+ */
+export function runMainLoop(options: MainLoopOptions): MainLoopStats;
+/** Makes runMainLoop() return after the current frame */
+export function stopMainLoop(): void;
+
 // Color-related functions
 /** Returns hexadecimal value for a Color */
 export function colorToInt(color: Color): number;
 /** Returns color normalized as float [0..1] */
-export function colorNormalize(color: Color): Vector4;
+export function colorNormalize<T extends Vector4 | Float32Array = Vector4>(color: Color, out?: T, offset?: number): T;
 /** Returns HSV values for a Color */
-export function colorToHSV(color: Color): Vector3;
+export function colorToHSV<T extends Vector3 | Float32Array = Vector3>(color: Color, out?: T, offset?: number): T;
 /** Returns a Color from HSV values */
-export function colorFromHSV(hsv: Vector3): Color;
+export function colorFromHSV<T extends Color | Uint8Array = Color>(hsv: Vector3, out?: T, offset?: number): T;
 /** Returns a Color struct from hexadecimal value */
-export function getColor(value: number): Color;
+export function getColor<T extends Color | Uint8Array = Color>(value: number, out?: T, offset?: number): T;
 /** Color fade-in or fade-out, alpha goes from 0.0f to 1.0f */
-export function fade(color: Color, alpha: number): Color;
+export function fade<T extends Color | Uint8Array = Color>(color: Color, alpha: number, out?: T, offset?: number): T;
 
 // Misc. functions
 /**
@@ -149,7 +187,7 @@ export function IsMouseButtonReleased(button: MouseButton): boolean;
 export function isMouseButtonUp(button: MouseButton): boolean;
 export function getMouseX(): number;
 export function getMouseY(): number;
-export function getMousePosition(): Vector2;
+export function getMousePosition<T extends Vector2 | Float32Array = Vector2>(out?: T, offset?: number): T;
 export function setMousePosition(x: number, y: number): void;
 export function setMouseOffset(x: number, y: number): void;
 export function setMouseScale(x: number, y: number): void;
@@ -158,7 +196,7 @@ export function getMouseWheelMove(): number;
 // Input-related functions: touch
 export function getTouchX(): number;
 export function getTouchY(): number;
-export function getTouchPosition(index: number): Vector2;
+export function getTouchPosition<T extends Vector2 | Float32Array = Vector2>(index: number, out?: T, offset?: number): T;
 
 // Gestures and Touch Handling Functions
 export function setGesturesEnabled(flags: number): void;
@@ -166,9 +204,9 @@ export function isGestureDetected(gesture: number): boolean;
 export function getGestureDetected(): number;
 export function getTouchPointsCount(): number;
 export function getGestureHoldDuration(): number;
-export function getGestureDragVector(): Vector2;
+export function getGestureDragVector<T extends Vector2 | Float32Array = Vector2>(out?: T, offset?: number): T;
 export function getGestureDragAngle(): number;
-export function getGesturePinchVector(): Vector2;
+export function getGesturePinchVector<T extends Vector2 | Float32Array = Vector2>(out?: T, offset?: number): T;
 export function getGesturePinchAngle(): number;
 
 // Camera System Functions
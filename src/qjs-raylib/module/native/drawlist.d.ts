@@ -0,0 +1,8 @@
+// Draw list functions
+/**
+ * Decodes and executes a buffer of recorded draw commands.
+ * @param commands Command words, see DrawList
+ * @param length Number of words to execute, the whole buffer if omitted
+ * @param strings Strings referenced by text commands
+ */
+export function submitDrawList(commands: ArrayBuffer | Uint32Array, length?: number, strings?: string[]): void;
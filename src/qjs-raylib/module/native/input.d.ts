@@ -0,0 +1,59 @@
+// Input snapshot functions
+/**
+ * Writes the keyboard, mouse, touch, gesture and gamepad state in one call, see InputLayout for the layout.
+ * Returns the destination, or a new ArrayBuffer when none is given.
+ */
+export function pollInput<T extends ArrayBuffer | ArrayBufferView = ArrayBuffer>(buffer?: T): T;
+
+export interface InputEventStats
+{
+	enabled: boolean;
+	/** Events waiting to be drained */
+	queued: number;
+	capacity: number;
+	/** Events recorded since the queue was enabled */
+	total: number;
+	/** Oldest events overwritten because the queue was full */
+	dropped: number;
+}
+
+// Input event functions
+/**
+ * Starts or stops recording keyboard, text, mouse and gamepad events with timestamps, needs an open window.
+ * Keyboard, text and mouse events are recorded as GLFW reports them, in order; gamepads are compared once per frame.
+ */
+export function setInputEvents(enabled: boolean): void;
+/** Moves as many queued events as fit into buffer (see InputEventLayout), returns how many were written */
+export function drainInputEvents(buffer: ArrayBuffer | ArrayBufferView): number;
+export function getInputEventStats(): InputEventStats;
+
+export interface InputRecordingState
+{
+	recording: boolean;
+	replaying: boolean;
+	/** Frame being replayed, or frames recorded so far */
+	frame: number;
+	frames: number;
+	/** Random seed of the recording or replay */
+	seed: number;
+}
+
+// Input recording functions
+/**
+ * Records the input and frame timing of every frame until stopInputRecording(), and seeds the random generator
+ * (with seed, or the current time) so getRandomValue() is reproducible.
+ */
+export function startInputRecording(fileName: string, seed?: number): void;
+/**
+ * Writes the recording to its file, returns how many frames it holds. A recording running out of memory is
+ * written out and stopped on its own, this then throws.
+ */
+export function stopInputRecording(): number;
+/**
+ * Replays a recording: input queries, pollInput(), getTime() and getFrameTime() answer from it frame by frame,
+ * and the random generator gets the recorded seed. Live input comes back at the end of the recording.
+ * Returns how many frames it holds.
+ */
+export function startInputReplay(fileName: string): number;
+export function stopInputReplay(): void;
+export function getInputRecordingState(): InputRecordingState;
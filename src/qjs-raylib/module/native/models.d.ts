@@ -1,4 +1,4 @@
-import { Vector3, Color, Texture, Vector2, Ray } from './qjs-raylib.so';
+import { Vector3, Color, Texture, Vector2, Ray, Model, Mesh } from './qjs-raylib.so';
 import { CubemapLayoutType } from '../enums';
 
 // Basic geometric 3D shapes drawing functions
@@ -21,6 +21,7 @@ export function drawGrid(slices: number, spacing: number): void;
 export function drawGizmo(position: Vector3): void;
 
 // Model loading/unloading functions
+export function loadModel(fileName: string): Model;
 
 // Mesh loading/unloading functions
 
@@ -29,6 +30,9 @@ export function drawGizmo(position: Vector3): void;
 // Model animations loading/unloading functions
 
 // Mesh generation functions
+export function genMeshPlane(width: number, length: number, resX: number, resZ: number): Mesh;
+export function genMeshCube(width: number, height: number, length: number): Mesh;
+export function genMeshSphere(radius: number, rings: number, slices: number): Mesh;
 
 // Mesh manipulation functions
 
@@ -1,8 +1,13 @@
 export * from './core';
 export * from './shapes';
+export * from './drawlist';
+export * from './input';
 export * from './text';
 export * from './textures';
 export * from './models';
+export * from './shaders';
+export * from './audio';
+export * from './runtime';
 
 type pointer = number;
 
@@ -75,6 +80,77 @@ export class Color
 	constructor(r: number, g: number, b: number, a?: number);
 }
 
+/**
+ * Packed array of Vector2 stored as consecutive float x, y pairs.
+ * Can be passed to native functions without per-element conversion.
+ */
+export class Vector2Array
+{
+	get length(): number;
+	get buffer(): ArrayBuffer;
+	/** Float32Array view sharing the same memory */
+	get data(): Float32Array;
+	/**
+	 * @param source Element count, an array of Vector2 to copy, or a buffer to wrap without copying
+	 */
+	constructor(source: number | Vector2[] | ArrayBuffer | Float32Array);
+	get(index: number): Vector2;
+	set(index: number, value: Vector2): void;
+}
+
+/**
+ * Packed array of Vector3 stored as consecutive float x, y, z triples.
+ */
+export class Vector3Array
+{
+	get length(): number;
+	get buffer(): ArrayBuffer;
+	/** Float32Array view sharing the same memory */
+	get data(): Float32Array;
+	/**
+	 * @param source Element count, an array of Vector3 to copy, or a buffer to wrap without copying
+	 */
+	constructor(source: number | Vector3[] | ArrayBuffer | Float32Array);
+	get(index: number): Vector3;
+	set(index: number, value: Vector3): void;
+}
+
+/**
+ * Packed array of Color stored as consecutive RGBA bytes.
+ */
+export class ColorArray
+{
+	get length(): number;
+	get buffer(): ArrayBuffer;
+	/** Uint8Array view sharing the same memory */
+	get data(): Uint8Array;
+	/**
+	 * @param source Element count, an array of Color to copy, or a buffer to wrap without copying
+	 */
+	constructor(source: number | Color[] | ArrayBuffer | Uint8Array);
+	get(index: number): Color;
+	set(index: number, value: Color): void;
+}
+
+/**
+ * Native copy of recorded draw commands, validated once and replayed with a single call.
+ * Suited to layers that rarely change, such as backgrounds or HUD frames.
+ */
+export class DisplayList
+{
+	/** False until recorded, and again after invalidate() */
+	get valid(): boolean;
+	/** Number of recorded words */
+	get length(): number;
+	constructor(commands?: ArrayBuffer | Uint32Array, length?: number, strings?: string[]);
+	/** Replaces the stored commands */
+	record(commands: ArrayBuffer | Uint32Array, length?: number, strings?: string[]): void;
+	/** Releases the stored commands until the next record() */
+	invalidate(): void;
+	/** Replays the stored commands, returns false when there is nothing valid to draw */
+	draw(): boolean;
+}
+
 export interface Rectangle
 {
 	x: number;
@@ -93,6 +169,7 @@ export class Image
 
 export class Texture
 {
+	get id(): number;
 	get width(): number;
 	get height(): number;
 	get format(): number;
@@ -132,20 +209,26 @@ export interface NPatchInfo
 
 export class CharInfo
 {
-	value: number;
-	rec: Rectangle;
-	offsetX: number;
-	offsetY: number;
-	advanceX: number;
-	data: pointer;
+	get value(): number;
+	get offsetX(): number;
+	get offsetY(): number;
+	get advanceX(): number;
+	/** The glyph image, owned by the font */
+	get image(): Image;
 }
 
 export class Font
 {
-	texture: Texture;
-	baseSize: number;
-	charsCount: number;
-	chars: CharInfo;
+	/** The glyph atlas, owned by the font */
+	get texture(): Texture;
+	get baseSize(): number;
+	get charsCount(): number;
+	get chars(): CharInfo[];
+	/**
+	 * Metrics of every glyph, GlyphMetric.GLYPH_STRIDE floats each (see GlyphMetric).
+	 * Built on first access and shared afterwards, integer fields are exact.
+	 */
+	readonly glyphMetrics: Float32Array;
 }
 
 export class Camera3D
@@ -169,32 +252,14 @@ export class Camera2D
 
 export class Mesh
 {
-	vertexCount: number;
-	triangleCount: number;
-
-	// Default vertex data
-	vertices: pointer;
-	texcoords: pointer;
-	texcoords2: pointer;
-	normals: pointer;
-	tangets: pointer;
-	colors: pointer;
-	indices: pointer;
-
-	// Animation vertex data
-	animVertices: pointer;
-	animNormals: pointer;
-	boneIds: pointer;
-	boneWeights: pointer;
-
-	// OpenGL identifiers
-	vaoId: Tuple<number, 7>;
+	get vertexCount(): number;
+	get triangleCount(): number;
+	get vaoId(): number;
 }
 
-export interface Shader
+export class Shader
 {
-	id: number;
-	locs: Tuple<number, 32>;
+	get id(): number;
 }
 
 export interface MaterialMap
@@ -227,18 +292,9 @@ export interface BoneInfo
 export class Model
 {
 	transform: Matrix;
-
-	meshCount: number;
-	meshes: pointer[];
-
-	materialCount: number;
-	materials: pointer[];
-	meshMaterial: pointer;
-
-	// Animation data
-	boneCount: number;
-	bones: pointer[];
-	bindPose: pointer[];
+	get meshCount(): number;
+	get materialCount(): number;
+	get boneCount(): number;
 }
 
 export class ModelAnimation
@@ -273,32 +329,26 @@ export interface BoundingBox
 
 export class Wave
 {
-	sampleCount: number;
-	sampleRate: number;
-	sampleSize: number;
-	channels: number;
-	data: pointer;
+	get sampleCount(): number;
+	get sampleRate(): number;
+	get sampleSize(): number;
+	get channels(): number;
 }
 
 export class Sound
 {
-	audioBuffer: pointer;
-	source: number;
-	buffer: number;
-	format: number;
+	get source(): number;
+	get buffer(): number;
+	get format(): number;
 }
 
 export class AudioStream
 {
-	sampleRate: number;
-	sampleSize: number;
-	channels: number;
-
-	audioBuffer: pointer;
-
-	format: number;
-	source: number;
-	buffers: pointer;
+	get sampleRate(): number;
+	get sampleSize(): number;
+	get channels(): number;
+	get format(): number;
+	get source(): number;
 }
 
 export interface VrDeviceInfo
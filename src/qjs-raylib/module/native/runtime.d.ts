@@ -0,0 +1,209 @@
+export interface PoolStats
+{
+	/** Objects currently alive */
+	live: number;
+	/** Highest amount of objects alive at the same time */
+	peak: number;
+	/** Total amount of allocations since startup */
+	allocated: number;
+	/** Total amount of objects returned to the pool since startup */
+	freed: number;
+	/** Slabs currently reserved by the pool */
+	slabs: number;
+	/** Bytes currently reserved by the pool */
+	bytes: number;
+}
+
+export interface StringCacheStats
+{
+	/** Strings currently held by the cache */
+	entries: number;
+	capacity: number;
+	/** Lookups answered without re-encoding the string */
+	hits: number;
+	misses: number;
+	/** Entries dropped to make room for another string */
+	evictions: number;
+	/** Entries dropped after going unused for a while */
+	expired: number;
+	/** hits / (hits + misses) */
+	hitRate: number;
+}
+
+export interface TextLayoutCacheStats
+{
+	/** Layouts currently cached */
+	entries: number;
+	/** Maximum amount of layouts, see setTextLayoutCacheSize() */
+	capacity: number;
+	/** Draws and measures served from a cached layout */
+	hits: number;
+	misses: number;
+	/** Layouts dropped as least recently used */
+	evictions: number;
+	/** Bytes currently used by cached layouts */
+	bytes: number;
+	/** hits / (hits + misses) */
+	hitRate: number;
+}
+
+export interface FrameProfileStats
+{
+	enabled: boolean;
+	/** Frames currently held by the profiler */
+	frames: number;
+	/** Frames kept, see setFrameProfiler() */
+	capacity: number;
+	/** Frame time percentiles in milliseconds */
+	p50: number;
+	p95: number;
+	p99: number;
+	max: number;
+	mean: number;
+}
+
+export interface TraceStats
+{
+	/** A trace is being recorded */
+	active: boolean;
+	/** Events recorded by the current or last trace */
+	events: number;
+	/** Events already written to the trace file */
+	written: number;
+	/** Events lost because no buffer could be allocated */
+	dropped: number;
+}
+
+export interface HeapStats
+{
+	/** Bytes allocated by the runtime */
+	mallocSize: number;
+	mallocCount: number;
+	/** -1 when unlimited */
+	mallocLimit: number;
+	memoryUsedSize: number;
+	memoryUsedCount: number;
+	atomCount: number;
+	atomSize: number;
+	stringCount: number;
+	stringSize: number;
+	objectCount: number;
+	objectSize: number;
+	propertyCount: number;
+	propertySize: number;
+	shapeCount: number;
+	shapeSize: number;
+	functionCount: number;
+	functionSize: number;
+	arrayCount: number;
+	fastArrayCount: number;
+	binaryObjectCount: number;
+	binaryObjectSize: number;
+	/** Collections run by the idle GC, see setIdleGc() */
+	idleCollections: number;
+	/** Milliseconds taken by the last idle collection */
+	lastCollectionTime: number;
+	/** Running average of idle collection times, in milliseconds */
+	estimatedCollectionTime: number;
+}
+
+export interface FrameArenaStats
+{
+	enabled: boolean;
+	/** Frames completed while the arena was enabled */
+	frames: number;
+	/** Total amount of values allocated from the arena */
+	allocated: number;
+	/** Total amount of values moved out of the arena by persist() */
+	persisted: number;
+	/** Chunks currently reserved by the arena */
+	chunks: number;
+	/** Chunks kept alive by values from previous frames */
+	retiredChunks: number;
+	/** Chunks ready to be reused */
+	spareChunks: number;
+	/** Bytes currently reserved by the arena */
+	bytes: number;
+}
+
+// Memory management functions
+/** Returns live/peak object counters for every pooled struct class */
+export function getPoolStats(): { [className: string]: PoolStats };
+/** Releases pool slabs that have no live objects left */
+export function trimPools(): void;
+/**
+ * Enables the frame arena: struct values created between beginDrawing() and endDrawing()
+ * are bump-allocated from a per-frame region that is rewound by endDrawing().
+ * Values that outlive their frame stay valid but keep their chunk reserved, see persist().
+ */
+export function setFrameArena(enabled: boolean): void;
+export function getFrameArenaStats(): FrameArenaStats;
+/** Moves a struct value out of the frame arena so it does not hold on to frame memory, returns the value */
+export function persist<T>(value: T): T;
+/**
+ * Returns counters of the cache that keeps the UTF-8 encoding of string arguments,
+ * e.g. the text passed to drawText() every frame
+ */
+export function getStringCacheStats(): StringCacheStats;
+/**
+ * Sets how many text layouts (glyph quads keyed by font, text, size and spacing) drawText(),
+ * drawTextEx(), measureText() and measureTextEx() keep around, 0 disables the cache
+ */
+export function setTextLayoutCacheSize(capacity: number): void;
+export function getTextLayoutCacheStats(): TextLayoutCacheStats;
+
+// Frame profiler functions
+/**
+ * Starts timing the phases of every frame into a ring of the last frames (240 by default), or stops it.
+ * Restarting clears the recorded frames.
+ */
+export function setFrameProfiler(enabled: boolean, frames?: number): void;
+/** Returns the recorded frames oldest first, FrameProfileLayout.FIELDS values per frame (see FrameProfileLayout) */
+export function getFrameProfile(): Float32Array;
+export function getFrameProfileStats(): FrameProfileStats;
+/**
+ * Draws a stacked graph of the recorded frame phases with frame time percentiles, must be called while drawing.
+ * The graph spans twice budget milliseconds (1000 / 60 by default).
+ */
+export function drawFrameProfile(x: number, y: number, width?: number, height?: number, budget?: number): void;
+
+// Tracing functions
+/**
+ * Starts recording a trace in Chrome trace-event format (open it in chrome://tracing or Perfetto), written
+ * to fileName (trace.json by default) by a background thread. Frame phases and script spans are always
+ * recorded, binding calls only when the library is built with TRACE_BINDINGS=1.
+ */
+export function startTrace(fileName?: string): void;
+/** Flushes and closes the trace, returns how many events were written */
+export function stopTrace(): number;
+/** Opens a script span, spans must be closed by traceEnd() in reverse order */
+export function traceBegin(name: string): void;
+export function traceEnd(): void;
+/** Marks a point in time */
+export function traceInstant(name: string): void;
+export function getTraceStats(): TraceStats;
+
+// Binding instrumentation functions
+/** Returns the name of every native function, in the order used by getBindingStats() */
+export function getBindingNames(): string[];
+/**
+ * Returns one row per binding called since the last reset, BindingStatsLayout.FIELDS values each (see
+ * BindingStatsLayout). Calling it with reset set once per frame gives per-frame figures.
+ * Only counts calls when the library is built with BINDING_STATS=1, otherwise the result is empty.
+ */
+export function getBindingStats(reset?: boolean): Float64Array;
+
+// Garbage collection functions
+/**
+ * Runs the garbage collector in endDrawing() when the frame finished early enough to absorb a collection
+ * before the setTargetFps() deadline, at most once every interval frames (30 by default).
+ * Does nothing while the frame rate is unlimited.
+ */
+export function setIdleGc(enabled: boolean, interval?: number): void;
+/**
+ * Sets how many bytes the runtime may allocate before QuickJS collects on its own. Raising it leaves
+ * collections to the idle GC; it is applied again after every idle collection since automatic ones reset it.
+ */
+export function setGcThreshold(bytes: number): void;
+/** Returns memory figures of the runtime (JS_ComputeMemoryUsage, which walks the heap) and idle GC timings */
+export function getHeapStats(): HeapStats;
@@ -0,0 +1,5 @@
+import { Shader } from './qjs-raylib.so';
+
+// Shader loading/unloading functions
+/** Either file may be left out to use the default shader for that stage */
+export function loadShader(vsFileName: string | null, fsFileName: string | null): Shader;
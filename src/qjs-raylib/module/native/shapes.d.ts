@@ -1,4 +1,8 @@
-import { Vector2, Color, Rectangle } from './qjs-raylib.so';
+import { Vector2, Vector2Array, Color, ColorArray, Rectangle } from './qjs-raylib.so';
+import { LineJoin } from '../enums';
+
+/** Points as Vector2 objects, a packed Vector2Array or a Float32Array of x, y pairs */
+export type Points = Vector2[] | Vector2Array | Float32Array;
 
 // Basic shapes drawing functions
 export function drawPixel(posX: number, posY: number, color: Color): void;
@@ -7,7 +11,13 @@ export function drawLine(startPosX: number, startPosY: number, endPosX: number,
 export function drawLineV(startPos: Vector2, endPos: Vector2, color: Color): void;
 export function drawLineEx(startPos: Vector2, endPos: Vector2, thick: number, color: Color): void;
 export function drawLineBezier(startPos: Vector2, endPos: Vector2, thick: number, color: Color): void;
-export function drawLineStrip(points: Vector2[], color: Color): void;
+export function drawLineStrip(points: Points, color: Color): void;
+/**
+ * Draws connected lines of any thickness, joints are filled according to `join`.
+ * @param join Joint style, LINE_JOIN_MITER if omitted
+ * @param closed Connects the last point back to the first one
+ */
+export function drawPolyline(points: Points, thick: number, color: Color, join?: LineJoin, closed?: boolean): void;
 
 export function drawCircle(centerX: number, centerY: number, radius: number, color: Color): void;
 export function drawCircleLines(centerX: number, centerY: number, radius: number, color: Color): void;
@@ -30,13 +40,28 @@ export function drawRectangleRounded(rec: Rectangle, roundness: number, segments
 export function drawRectangleRoundedLines(rec: Rectangle, roundness: number, segments: number, lineThick: number, color: Color): void;
 export function drawTriangle(v1: Vector2, v2: Vector2, v3: Vector2, color: Color): void;
 export function drawTriangleLines(points: Vector2[], color: Color): void;
-export function drawTriangleFan(center: Vector2, sides: number, radius: number, rotation: number, color: Color): void;
+export function drawTriangleFan(points: Points, color: Color): void;
+export function drawTriangleStrip(points: Points, color: Color): void;
+
+// Batched shapes drawing functions
+/**
+ * Colors for batched drawing: a single Color or 0xRRGGBBAA number (as taken by getColor()) shared by every
+ * instance, or one color per instance as a ColorArray or raw r, g, b, a bytes. Per-instance colors are read
+ * in memory order, so a Uint32Array word holds 0xAABBGGRR on little-endian platforms.
+ */
+export type BatchColors = Color | number | ColorArray | Uint32Array | Uint8Array;
+/** Draws rectangles packed as x, y, width, height */
+export function drawRectangles(rects: Float32Array, colors: BatchColors): void;
+/** Draws circles packed as centerX, centerY, radius */
+export function drawCircles(circles: Float32Array, colors: BatchColors): void;
+/** Draws pixels packed as x, y */
+export function drawPixels(points: Float32Array, colors: BatchColors): void;
 
 // Basic shapes collision detection functions
 export function checkCollisionRecs(rec1: Rectangle, rec2: Rectangle): boolean;
 export function checkCollisionCircles(center1: Vector2, radius1: number, center2: Vector2, radius2: number): boolean;
 export function checkCollisionCircleRec(center: Vector2, radius: number, rec: Rectangle): boolean;
-export function getCollisionRec(rec1: Rectangle, rec2: Rectangle): Rectangle;
+export function getCollisionRec<T extends Rectangle | Float32Array = Rectangle>(rec1: Rectangle, rec2: Rectangle, out?: T, offset?: number): T;
 export function checkCollisionPointRec(point: Vector2, rec: Rectangle): boolean;
 export function checkCollisionPointCircle(point: Vector2, center: Vector2, radius: number): boolean;
 export function checkCollisionPointTriangle(point: Vector2, p1: Vector2, p2: Vector2, p3: Vector2): boolean;
@@ -18,8 +18,16 @@ export function drawTextRecEx(font: Font, text: string, rec: Rectangle, fontSize
 
 // Text misc. functions
 export function measureText(text: string, fontSize: number): number;
-export function measureTextEx(font: Font, text: string, fontSize: number, spacing: number): Vector2;
+export function measureTextEx<T extends Vector2 | Float32Array = Vector2>(font: Font, text: string, fontSize: number, spacing: number, out?: T, offset?: number): T;
 export function getGlyphIndex(font: Font, character: number): number;
+/** Measures every string like measureTextEx(), returns [width0, height0, width1, height1, ...] */
+export function measureTextBatch(font: Font, texts: string[], fontSize: number, spacing: number): Float32Array;
+/**
+ * Word-wraps text to maxWidth, returns the offsets (as used by String.prototype.slice) where every line
+ * after the first one starts. Lines break after whitespace, words wider than maxWidth are split,
+ * and '\n' always starts a new line.
+ */
+export function breakTextLines(font: Font, text: string, fontSize: number, spacing: number, maxWidth: number): Uint32Array;
 
 // Text strings management functions
 
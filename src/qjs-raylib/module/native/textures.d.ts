@@ -1,9 +1,9 @@
-import { Image, Vector4, Color, RenderTexture, Texture } from './qjs-raylib.so';
+import { Image, Vector4, Color, ColorArray, Rectangle, RenderTexture, Texture } from './qjs-raylib.so';
 import { CubemapLayoutType } from '../enums';
 
 // Image/Texture2D data loading/unloading/saving functions
 export function loadImage(fileName: string): Image;
-export function loadImageEx(pixels: Color[], width: number, height: number): Image;
+export function loadImageEx(pixels: Color[] | ColorArray, width: number, height: number): Image;
 export function loadImagePro(pixels: number[], width: number, height: number, format: number): Image;
 export function loadImageRaw(fileName: string, width: number, height: number, format: number, headerSize: number): Image;
 export function exportImage(image: Image, fileName: string): void;
@@ -17,7 +17,28 @@ export function unloadTexture(texture: Texture): void;
 export function unloadRenderTexture(texture: RenderTexture): void;
 export function getImageData(image: Image): Color[];
 export function getImageDataNormalized(image: Image): Vector4[];
+/** Returns the image pixels as packed RGBA bytes, without creating a Color per pixel */
+export function getImageDataBuffer(image: Image): Uint8Array;
+/** Returns the image pixels as packed normalized RGBA floats, without creating a Vector4 per pixel */
+export function getImageDataNormalizedBuffer(image: Image): Float32Array;
 export function getPixelDataSize(width: number, height: number, format: number): number;
 export function getTextureData(texture: Texture): Image;
 export function getScreenData(): Image;
-export function updateTexture(texture: Texture, pixels: number[]): void;
\ No newline at end of file
+/**
+ * Updates the whole texture with new pixel data in the texture format.
+ * Buffers are read in place and must hold at least getPixelDataSize() bytes.
+ */
+export function updateTexture(texture: Texture, pixels: number[] | ArrayBuffer | ArrayBufferView): void;
+/**
+ * Updates a sub-rectangle of an uncompressed texture with new pixel data in the texture format.
+ */
+export function updateTextureRec(texture: Texture, rec: Rectangle, pixels: ArrayBuffer | ArrayBufferView): void;
+
+// Texture2D drawing functions
+/**
+ * Draws many sprites of one texture in a single pass.
+ * Every instance is 12 floats: srcX, srcY, srcWidth, srcHeight, x, y, originX, originY, rotation, scaleX, scaleY
+ * and a tint stored as packed RGBA bits (write it through a Uint32Array view of the same buffer).
+ * @param count Number of instances to draw, the whole buffer if omitted
+ */
+export function drawTextureBatch(texture: Texture, instances: Float32Array, count?: number): void;
@@ -0,0 +1,71 @@
+import * as rl from './native/qjs-raylib.so';
+
+// Memory management functions
+export const getPoolStats = rl.getPoolStats;
+export const trimPools = rl.trimPools;
+export const setFrameArena = rl.setFrameArena;
+export const getFrameArenaStats = rl.getFrameArenaStats;
+export const persist = rl.persist;
+export const getStringCacheStats = rl.getStringCacheStats;
+export const setTextLayoutCacheSize = rl.setTextLayoutCacheSize;
+export const getTextLayoutCacheStats = rl.getTextLayoutCacheStats;
+
+// Frame profiler functions
+export const setFrameProfiler = rl.setFrameProfiler;
+export const getFrameProfile = rl.getFrameProfile;
+export const getFrameProfileStats = rl.getFrameProfileStats;
+export const drawFrameProfile = rl.drawFrameProfile;
+
+// Tracing functions
+export const startTrace = rl.startTrace;
+export const stopTrace = rl.stopTrace;
+export const traceBegin = rl.traceBegin;
+export const traceEnd = rl.traceEnd;
+export const traceInstant = rl.traceInstant;
+export const getTraceStats = rl.getTraceStats;
+
+// Binding instrumentation functions
+export const getBindingNames = rl.getBindingNames;
+export const getBindingStats = rl.getBindingStats;
+
+// Garbage collection functions
+export const setIdleGc = rl.setIdleGc;
+export const setGcThreshold = rl.setGcThreshold;
+export const getHeapStats = rl.getHeapStats;
+
+// Fields of every frame returned by getFrameProfile(), in milliseconds. Must stay in sync with
+// JSRLProfilePhase in native/profiler.h
+export enum FrameProfileLayout
+{
+	/** Fixed-step updates of runMainLoop() */
+	UPDATE = 0,
+	/** beginDrawing() up to endDrawing() */
+	DRAW = 1,
+	/** endDrawing(): batch flush, buffer swap and frame rate wait */
+	SWAP = 2,
+	/** Promise jobs run by runMainLoop() */
+	JOBS = 3,
+	/** Garbage collections started by qjs-raylib */
+	GC = 4,
+	/** Whole frame, endDrawing() to endDrawing() */
+	TOTAL = 5,
+	/** Frame time no phase accounts for */
+	OTHER = 6,
+	FIELDS = 7,
+}
+
+// Row layout of getBindingStats(), must stay in sync with JS_RL_BINDING_STATS_FIELDS in native/bindings.h
+export enum BindingStatsLayout
+{
+	/** Index into getBindingNames() */
+	INDEX = 0,
+	CALLS = 1,
+	/** Milliseconds spent in the binding, callbacks into JS included */
+	TOTAL = 2,
+	/** Slowest call in milliseconds */
+	MAX = 3,
+	/** Calls under 1us, then one bucket per power of two microseconds, the last one holding calls of 1024us and more */
+	HISTOGRAM = 4,
+	HISTOGRAM_BUCKETS = 12,
+	FIELDS = 16,
+}
@@ -1,5 +1,8 @@
+import * as rl from './native/qjs-raylib.so';
+
 // Shader loading/unloading functions
 
+export const loadShader = rl.loadShader;
 
 // Shader configuration functions
 
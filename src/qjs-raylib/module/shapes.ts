@@ -8,6 +8,7 @@ export const drawLineV = rl.drawLineV;
 export const drawLineEx = rl.drawLineEx;
 export const drawLineBezier = rl.drawLineBezier;
 export const drawLineStrip = rl.drawLineStrip;
+export const drawPolyline = rl.drawPolyline;
 export const drawCircle = rl.drawCircle;
 export const drawCircleLines = rl.drawCircleLines;
 export const drawCircleSector = rl.drawCircleSector;
@@ -30,6 +31,12 @@ export const drawRectangleRoundedLines = rl.drawRectangleRoundedLines;
 export const drawTriangle = rl.drawTriangle;
 export const drawTriangleLines = rl.drawTriangleLines;
 export const drawTriangleFan = rl.drawTriangleFan;
+export const drawTriangleStrip = rl.drawTriangleStrip;
+
+// Batched shapes drawing functions
+export const drawRectangles = rl.drawRectangles;
+export const drawCircles = rl.drawCircles;
+export const drawPixels = rl.drawPixels;
 
 // Basic shapes collision detection functions
 export const checkCollisionRecs = rl.checkCollisionRecs;
@@ -0,0 +1,67 @@
+import * as rl from './native/qjs-raylib.so';
+import { Color, Texture } from './native/qjs-raylib.so';
+import { packColor } from './drawlist';
+
+// Must stay in sync with JS_RL_SPRITE_FLOATS in native/qjs-raylib.c
+export const SPRITE_FLOATS = 12;
+
+/**
+ * Collects sprite instances for a single texture and draws them with one drawTextureBatch() call.
+ */
+export class SpriteBatch
+{
+	private floats: Float32Array;
+	private words: Uint32Array;
+	private size = 0;
+
+	constructor(capacity = 1024)
+	{
+		this.floats = new Float32Array(capacity * SPRITE_FLOATS);
+		this.words = new Uint32Array(this.floats.buffer);
+	}
+
+	/** Number of recorded sprites */
+	get length(): number
+	{
+		return this.size;
+	}
+
+	clear(): void
+	{
+		this.size = 0;
+	}
+
+	/**
+	 * Adds a sprite, origin is given in source pixels and rotation in degrees.
+	 * Negative scales mirror the sprite.
+	 */
+	add(srcX: number, srcY: number, srcWidth: number, srcHeight: number, x: number, y: number, originX = 0, originY = 0, rotation = 0, scaleX = 1, scaleY = 1, tint: Color | number = 0xffffffff): void
+	{
+		if ((this.size + 1) * SPRITE_FLOATS > this.floats.length)
+		{
+			const floats = new Float32Array(this.floats.length * 2);
+			floats.set(this.floats);
+			this.floats = floats;
+			this.words = new Uint32Array(floats.buffer);
+		}
+
+		const i = this.size++ * SPRITE_FLOATS;
+		this.floats[i] = srcX;
+		this.floats[i + 1] = srcY;
+		this.floats[i + 2] = srcWidth;
+		this.floats[i + 3] = srcHeight;
+		this.floats[i + 4] = x;
+		this.floats[i + 5] = y;
+		this.floats[i + 6] = originX;
+		this.floats[i + 7] = originY;
+		this.floats[i + 8] = rotation;
+		this.floats[i + 9] = scaleX;
+		this.floats[i + 10] = scaleY;
+		this.words[i + 11] = packColor(tint);
+	}
+
+	draw(texture: Texture): void
+	{
+		rl.drawTextureBatch(texture, this.floats, this.size);
+	}
+}
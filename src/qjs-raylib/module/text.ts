@@ -21,6 +21,8 @@ export const drawTextRecEx = rl.drawTextRecEx;
 export const measureText = rl.measureText;
 export const measureTextEx = rl.measureTextEx;
 export const getGlyphIndex = rl.getGlyphIndex;
+export const measureTextBatch = rl.measureTextBatch;
+export const breakTextLines = rl.breakTextLines;
 
 // Text strings management functions
 
@@ -16,7 +16,13 @@ export const unloadTexture = rl.unloadTexture;
 export const unloadRenderTexture = rl.unloadRenderTexture;
 export const getImageData = rl.getImageData;
 export const getImageDataNormalized = rl.getImageDataNormalized;
+export const getImageDataBuffer = rl.getImageDataBuffer;
+export const getImageDataNormalizedBuffer = rl.getImageDataNormalizedBuffer;
 export const getPixelDataSize = rl.getPixelDataSize;
 export const getTextureData = rl.getTextureData;
 export const getScreenData = rl.getScreenData;
-export const updateTexture = rl.updateTexture;
\ No newline at end of file
+export const updateTexture = rl.updateTexture;
+export const updateTextureRec = rl.updateTextureRec;
+
+// Texture2D drawing functions
+export const drawTextureBatch = rl.drawTextureBatch;
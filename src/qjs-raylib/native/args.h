@@ -0,0 +1,91 @@
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+
+#pragma region Argument decoding
+
+// Bindings decode their arguments through these macros. A struct argument of
+// the wrong class throws a TypeError from the binding. Numbers take a tag fast
+// path and only go through the full ToNumber coercion for values that aren't
+// numbers already.
+
+static inline int js_rl_to_int32(JSContext* ctx, int32_t* pres, JSValueConst val)
+{
+	if (likely(JS_VALUE_GET_TAG(val) == JS_TAG_INT))
+	{
+		*pres = JS_VALUE_GET_INT(val);
+		return 0;
+	}
+
+	return JS_ToInt32(ctx, pres, val);
+}
+
+static inline int js_rl_to_uint32(JSContext* ctx, uint32_t* pres, JSValueConst val)
+{
+	if (likely(JS_VALUE_GET_TAG(val) == JS_TAG_INT))
+	{
+		*pres = (uint32_t)JS_VALUE_GET_INT(val);
+		return 0;
+	}
+
+	return JS_ToInt32(ctx, (int32_t*)pres, val);
+}
+
+static inline int js_rl_to_float64(JSContext* ctx, double* pres, JSValueConst val)
+{
+	int tag = JS_VALUE_GET_NORM_TAG(val);
+
+	if (likely(JS_TAG_IS_FLOAT64(tag)))
+	{
+		*pres = JS_VALUE_GET_FLOAT64(val);
+		return 0;
+	}
+
+	if (tag == JS_TAG_INT)
+	{
+		*pres = JS_VALUE_GET_INT(val);
+		return 0;
+	}
+
+	return JS_ToFloat64(ctx, pres, val);
+}
+
+static inline int js_rl_to_int64(JSContext* ctx, int64_t* pres, JSValueConst val)
+{
+	if (likely(JS_VALUE_GET_TAG(val) == JS_TAG_INT))
+	{
+		*pres = JS_VALUE_GET_INT(val);
+		return 0;
+	}
+
+	return JS_ToInt64(ctx, pres, val);
+}
+
+// Same results as JS_ToInt32, JS_ToUint32, JS_ToFloat64 and JS_ToInt64
+#define JS_RL_TO_INT32(ctx, pres, val) js_rl_to_int32(ctx, pres, val)
+#define JS_RL_TO_UINT32(ctx, pres, val) js_rl_to_uint32(ctx, pres, val)
+#define JS_RL_TO_FLOAT64(ctx, pres, val) js_rl_to_float64(ctx, pres, val)
+#define JS_RL_TO_INT64(ctx, pres, val) js_rl_to_int64(ctx, pres, val)
+
+// Always checked, for callers that clean up before returning JS_EXCEPTION on
+// NULL (the TypeError is already thrown)
+#define JS_RL_GET_OPAQUE(ctx, val, class_id) JS_GetOpaque2(ctx, val, class_id)
+
+// JS_RL_ARG_POINTER declares type* var pointing at the struct held by val,
+// JS_RL_ARG_VALUE declares type var holding a copy of it. Both return
+// JS_EXCEPTION from the binding when val isn't of class_id.
+#define JS_RL_ARG_POINTER(ctx, type, var, val, class_id) \
+	type* var = (type*)JS_GetOpaque2(ctx, val, class_id); \
+	if (!var) \
+		return JS_EXCEPTION
+
+#define JS_RL_ARG_VALUE(ctx, type, var, val, class_id) \
+	type var; \
+	{ \
+		type* var##_opaque = (type*)JS_GetOpaque2(ctx, val, class_id); \
+		if (!var##_opaque) \
+			return JS_EXCEPTION; \
+		var = *var##_opaque; \
+	} \
+	do {} while (0)
+
+#pragma endregion
@@ -0,0 +1,221 @@
+#include "stdlib.h"
+#include "time.h"
+
+#include "bindings.h"
+#include "structs.h"
+#include "trace.h"
+
+#pragma region Binding instrumentation
+
+#if defined(JS_RL_TRACE_BINDINGS) || defined(JS_RL_BINDING_STATS)
+#define JS_RL_WRAP_BINDINGS
+#endif
+
+typedef struct JSRLBindingStats
+{
+	int64_t calls;
+	int64_t total_ns;
+	int64_t max_ns;
+	uint32_t histogram[JS_RL_BINDING_HISTOGRAM_BUCKETS];
+} JSRLBindingStats;
+
+// There is a single function table, shared by every runtime
+static const JSCFunctionListEntry* js_rl_bindings;
+static int js_rl_binding_count;
+
+#ifdef JS_RL_BINDING_STATS
+static JSRLBindingStats* js_rl_binding_stats;
+#endif
+
+#ifdef JS_RL_WRAP_BINDINGS
+
+static int64_t js_rl_binding_clock(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#ifdef JS_RL_BINDING_STATS
+
+static void js_rl_count_binding_call(int index, int64_t ns)
+{
+	JSRLBindingStats* stats = &js_rl_binding_stats[index];
+	int64_t us = ns / 1000;
+	int bucket = 0;
+
+	while (us > 0 && bucket < JS_RL_BINDING_HISTOGRAM_BUCKETS - 1)
+	{
+		us >>= 1;
+		bucket++;
+	}
+
+	stats->calls++;
+	stats->total_ns += ns;
+	stats->histogram[bucket]++;
+
+	if (stats->max_ns < ns)
+		stats->max_ns = ns;
+}
+
+#endif
+
+// Times are inclusive: a binding calling back into JS (runMainLoop) also
+// accounts for the bindings called from there
+static JSValue js_rl_wrapped_call(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic, JSValue* func_data)
+{
+	const JSCFunctionListEntry* entry = &js_rl_bindings[magic];
+	BOOL traced = js_rl_tracing();
+	int64_t start = js_rl_binding_clock();
+	JSValue ret;
+
+	if (entry->u.func.cproto == JS_CFUNC_generic_magic)
+		ret = entry->u.func.cfunc.generic_magic(ctx, this_val, argc, argv, entry->magic);
+	else
+		ret = entry->u.func.cfunc.generic(ctx, this_val, argc, argv);
+
+	int64_t end = js_rl_binding_clock();
+
+#ifdef JS_RL_BINDING_STATS
+	js_rl_count_binding_call(magic, end - start);
+#endif
+
+#ifdef JS_RL_TRACE_BINDINGS
+	// Tracing may have been started or stopped by the call itself
+	if (traced && js_rl_tracing())
+		js_rl_trace_complete(JS_RL_TRACE_BINDING, entry->name, start / 1e3, end / 1e3);
+#else
+	(void)traced;
+#endif
+
+	return ret;
+}
+
+#endif
+
+int js_rl_set_module_export_list(JSContext* ctx, JSModuleDef* m, const JSCFunctionListEntry* tab, int len)
+{
+	js_rl_bindings = tab;
+	js_rl_binding_count = len;
+
+#ifdef JS_RL_BINDING_STATS
+	if (!js_rl_binding_stats)
+	{
+		js_rl_binding_stats = calloc(len, sizeof(JSRLBindingStats));
+
+		if (!js_rl_binding_stats)
+		{
+			JS_ThrowOutOfMemory(ctx);
+			return -1;
+		}
+	}
+#endif
+
+#ifdef JS_RL_WRAP_BINDINGS
+	for (int i = 0; i < len; i++)
+	{
+		const JSCFunctionListEntry* entry = &tab[i];
+
+		if (entry->def_type != JS_DEF_CFUNC ||
+			(entry->u.func.cproto != JS_CFUNC_generic && entry->u.func.cproto != JS_CFUNC_generic_magic))
+		{
+			if (JS_SetModuleExportList(ctx, m, entry, 1))
+				return -1;
+
+			continue;
+		}
+
+		// The table index is passed as magic so the wrapper finds its entry
+		JSValue func = JS_NewCFunctionData(ctx, js_rl_wrapped_call, entry->u.func.length, i, 0, NULL);
+
+		if (JS_IsException(func))
+			return -1;
+
+		JS_DefinePropertyValueStr(ctx, func, "name", JS_NewString(ctx, entry->name), JS_PROP_CONFIGURABLE);
+
+		if (JS_SetModuleExport(ctx, m, entry->name, func))
+			return -1;
+	}
+
+	return 0;
+#else
+	return JS_SetModuleExportList(ctx, m, tab, len);
+#endif
+}
+
+JSValue js_rl_get_binding_names(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSValue names = JS_NewArray(ctx);
+
+	if (JS_IsException(names))
+		return names;
+
+	for (int i = 0; i < js_rl_binding_count; i++)
+	{
+		if (JS_SetPropertyUint32(ctx, names, i, JS_NewString(ctx, js_rl_bindings[i].name)) < 0)
+		{
+			JS_FreeValue(ctx, names);
+			return JS_EXCEPTION;
+		}
+	}
+
+	return names;
+}
+
+JSValue js_rl_get_binding_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int reset = argc > 0 ? JS_ToBool(ctx, argv[0]) : FALSE;
+
+	if (reset < 0)
+		return JS_EXCEPTION;
+
+	uint32_t rows = 0;
+
+#ifdef JS_RL_BINDING_STATS
+	for (int i = 0; i < js_rl_binding_count; i++)
+	{
+		if (js_rl_binding_stats[i].calls)
+			rows++;
+	}
+#endif
+
+	JSValue buffer = js_rl_new_array_buffer(ctx, (size_t)rows * JS_RL_BINDING_STATS_FIELDS * sizeof(double));
+
+	if (JS_IsException(buffer))
+		return buffer;
+
+#ifdef JS_RL_BINDING_STATS
+	size_t size;
+	double* row = (double*)JS_GetArrayBuffer(ctx, &size, buffer);
+
+	// Only bindings called since the last reset get a row
+	for (int i = 0; i < js_rl_binding_count; i++)
+	{
+		JSRLBindingStats* stats = &js_rl_binding_stats[i];
+
+		if (!stats->calls)
+			continue;
+
+		row[0] = i;
+		row[1] = (double)stats->calls;
+		row[2] = stats->total_ns / 1e6;
+		row[3] = stats->max_ns / 1e6;
+
+		for (int b = 0; b < JS_RL_BINDING_HISTOGRAM_BUCKETS; b++)
+			row[4 + b] = stats->histogram[b];
+
+		row += JS_RL_BINDING_STATS_FIELDS;
+
+		if (reset)
+			memset(stats, 0, sizeof(JSRLBindingStats));
+	}
+#endif
+
+	JSValue view = js_rl_new_typed_array(ctx, "Float64Array", buffer, 0, (size_t)rows * JS_RL_BINDING_STATS_FIELDS);
+	JS_FreeValue(ctx, buffer);
+
+	return view;
+}
+
+#pragma endregion
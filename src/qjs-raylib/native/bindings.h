@@ -0,0 +1,26 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+
+#pragma region Binding instrumentation
+
+// Calls taking under 1us land in bucket 0, bucket n >= 1 holds calls taking
+// [2^(n-1), 2^n) us and the last bucket everything slower
+#define JS_RL_BINDING_HISTOGRAM_BUCKETS 12
+
+// Doubles per row of getBindingStats(): binding index, calls, total and max
+// milliseconds, then the histogram. Must stay in sync with BindingStatsLayout
+// in module/runtime.ts.
+#define JS_RL_BINDING_STATS_FIELDS (4 + JS_RL_BINDING_HISTOGRAM_BUCKETS)
+
+// Exports tab from m. Built with JS_RL_TRACE_BINDINGS or JS_RL_BINDING_STATS,
+// every function is exported through a wrapper that traces or counts its
+// calls; otherwise the table is exported as is.
+int js_rl_set_module_export_list(JSContext* ctx, JSModuleDef* m, const JSCFunctionListEntry* tab, int len);
+
+JSValue js_rl_get_binding_names(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_binding_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
@@ -0,0 +1,471 @@
+#include "drawlist.h"
+#include "structs.h"
+#include "args.h"
+
+#pragma region Draw list
+
+// A draw list is a flat sequence of 32-bit words: an opcode followed by its
+// arguments. Coordinates are floats, colors are RGBA bytes packed in a word so
+// they share the memory layout of Color, strings are indexes into a side array.
+
+// Number of argument words following each opcode
+static const uint8_t js_rl_draw_op_words[JS_RL_DRAW_OP_COUNT] =
+{
+	[JS_RL_DRAW_CLEAR] = 1,
+	[JS_RL_DRAW_PIXEL] = 3,
+	[JS_RL_DRAW_LINE] = 5,
+	[JS_RL_DRAW_LINE_EX] = 6,
+	[JS_RL_DRAW_CIRCLE] = 4,
+	[JS_RL_DRAW_CIRCLE_LINES] = 4,
+	[JS_RL_DRAW_RECTANGLE] = 5,
+	[JS_RL_DRAW_RECTANGLE_LINES] = 5,
+	[JS_RL_DRAW_RECTANGLE_PRO] = 8,
+	[JS_RL_DRAW_RECTANGLE_GRADIENT] = 8,
+	[JS_RL_DRAW_TRIANGLE] = 7,
+	[JS_RL_DRAW_TRIANGLE_LINES] = 7,
+	[JS_RL_DRAW_TEXT] = 5,
+};
+
+static inline float js_rl_draw_float(const uint32_t* w)
+{
+	union { uint32_t u; float f; } v = { .u = *w };
+	return v.f;
+}
+
+static inline Color js_rl_draw_color(const uint32_t* w)
+{
+	Color color;
+	memcpy(&color, w, sizeof(Color));
+	return color;
+}
+
+static inline Vector2 js_rl_draw_vector2(const uint32_t* w)
+{
+	return (Vector2){ js_rl_draw_float(w), js_rl_draw_float(w + 1) };
+}
+
+static inline Rectangle js_rl_draw_rectangle(const uint32_t* w)
+{
+	return (Rectangle){ js_rl_draw_float(w), js_rl_draw_float(w + 1), js_rl_draw_float(w + 2), js_rl_draw_float(w + 3) };
+}
+
+// Validates opcodes, command sizes and string indexes so replaying needs no checks
+static int js_rl_check_draw_commands(JSContext* ctx, const uint32_t* words, uint32_t count, uint32_t text_count)
+{
+	uint32_t i = 0;
+
+	while (i < count)
+	{
+		uint32_t op = words[i];
+
+		if (op == 0 || op >= JS_RL_DRAW_OP_COUNT)
+		{
+			JS_ThrowRangeError(ctx, "invalid draw opcode %u at word %u", op, i);
+			return -1;
+		}
+
+		if (i + 1 + js_rl_draw_op_words[op] > count)
+		{
+			JS_ThrowRangeError(ctx, "truncated draw command at word %u", i);
+			return -1;
+		}
+
+		if (op == JS_RL_DRAW_TEXT && words[i + 1] >= text_count)
+		{
+			JS_ThrowRangeError(ctx, "draw command at word %u references missing string %u", i, words[i + 1]);
+			return -1;
+		}
+
+		i += 1 + js_rl_draw_op_words[op];
+	}
+
+	return 0;
+}
+
+static void js_rl_run_draw_commands(const uint32_t* words, uint32_t count, const char* const* texts)
+{
+	uint32_t i = 0;
+
+	while (i < count)
+	{
+		uint32_t op = words[i];
+		const uint32_t* a = words + i + 1;
+		i += 1 + js_rl_draw_op_words[op];
+
+		switch (op)
+		{
+			case JS_RL_DRAW_CLEAR:
+				ClearBackground(js_rl_draw_color(a));
+				break;
+			case JS_RL_DRAW_PIXEL:
+				DrawPixelV(js_rl_draw_vector2(a), js_rl_draw_color(a + 2));
+				break;
+			case JS_RL_DRAW_LINE:
+				DrawLineV(js_rl_draw_vector2(a), js_rl_draw_vector2(a + 2), js_rl_draw_color(a + 4));
+				break;
+			case JS_RL_DRAW_LINE_EX:
+				DrawLineEx(js_rl_draw_vector2(a), js_rl_draw_vector2(a + 2), js_rl_draw_float(a + 4), js_rl_draw_color(a + 5));
+				break;
+			case JS_RL_DRAW_CIRCLE:
+				DrawCircleV(js_rl_draw_vector2(a), js_rl_draw_float(a + 2), js_rl_draw_color(a + 3));
+				break;
+			case JS_RL_DRAW_CIRCLE_LINES:
+				DrawCircleLines((int)js_rl_draw_float(a), (int)js_rl_draw_float(a + 1), js_rl_draw_float(a + 2), js_rl_draw_color(a + 3));
+				break;
+			case JS_RL_DRAW_RECTANGLE:
+				DrawRectangleRec(js_rl_draw_rectangle(a), js_rl_draw_color(a + 4));
+				break;
+			case JS_RL_DRAW_RECTANGLE_LINES:
+				DrawRectangleLinesEx(js_rl_draw_rectangle(a), 1, js_rl_draw_color(a + 4));
+				break;
+			case JS_RL_DRAW_RECTANGLE_PRO:
+				DrawRectanglePro(js_rl_draw_rectangle(a), js_rl_draw_vector2(a + 4), js_rl_draw_float(a + 6), js_rl_draw_color(a + 7));
+				break;
+			case JS_RL_DRAW_RECTANGLE_GRADIENT:
+				DrawRectangleGradientEx(js_rl_draw_rectangle(a), js_rl_draw_color(a + 4), js_rl_draw_color(a + 5), js_rl_draw_color(a + 6), js_rl_draw_color(a + 7));
+				break;
+			case JS_RL_DRAW_TRIANGLE:
+				DrawTriangle(js_rl_draw_vector2(a), js_rl_draw_vector2(a + 2), js_rl_draw_vector2(a + 4), js_rl_draw_color(a + 6));
+				break;
+			case JS_RL_DRAW_TRIANGLE_LINES:
+				DrawTriangleLines(js_rl_draw_vector2(a), js_rl_draw_vector2(a + 2), js_rl_draw_vector2(a + 4), js_rl_draw_color(a + 6));
+				break;
+			case JS_RL_DRAW_TEXT:
+				DrawText(texts[a[0]], (int)js_rl_draw_float(a + 1), (int)js_rl_draw_float(a + 2), (int)js_rl_draw_float(a + 3), js_rl_draw_color(a + 4));
+				break;
+		}
+	}
+}
+
+static int js_rl_get_draw_string_count(JSContext* ctx, JSValueConst strings, uint32_t* count)
+{
+	*count = 0;
+
+	if (JS_IsUndefined(strings))
+		return 0;
+
+	JSValue len_val = JS_GetProperty(ctx, strings, JS_ATOM_length);
+	int ret = JS_RL_TO_UINT32(ctx, count, len_val);
+	JS_FreeValue(ctx, len_val);
+
+	return ret;
+}
+
+static void js_rl_free_draw_strings(JSContext* ctx, const char** texts, uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (texts[i])
+			JS_FreeCString(ctx, texts[i]);
+	}
+
+	js_free(ctx, texts);
+}
+
+static const char** js_rl_get_draw_strings(JSContext* ctx, JSValueConst strings, uint32_t count)
+{
+	const char** texts = js_mallocz(ctx, max_int(count, 1) * sizeof(char*));
+
+	if (!texts)
+		return NULL;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		JSValue str = JS_GetPropertyUint32(ctx, strings, i);
+		texts[i] = JS_ToCString(ctx, str);
+		JS_FreeValue(ctx, str);
+
+		if (!texts[i])
+		{
+			js_rl_free_draw_strings(ctx, texts, count);
+			return NULL;
+		}
+	}
+
+	return texts;
+}
+
+// Resolves the (commands, length) argument pair shared by the draw list
+// functions. The length is converted first: its valueOf could otherwise
+// detach or resize the buffer after it has been resolved.
+static const uint32_t* js_rl_get_draw_words(JSContext* ctx, JSValueConst commands, JSValueConst length, uint32_t* count)
+{
+	uint32_t value = 0;
+
+	if (!JS_IsUndefined(length) && JS_RL_TO_UINT32(ctx, &value, length))
+		return NULL;
+
+	size_t size;
+	uint8_t* data = js_rl_get_array_buffer(ctx, commands, &size);
+
+	if (!data)
+		return NULL;
+
+	if ((uintptr_t)data % sizeof(uint32_t))
+	{
+		JS_ThrowRangeError(ctx, "draw list buffer must be 4-byte aligned");
+		return NULL;
+	}
+
+	*count = size / sizeof(uint32_t);
+
+	if (!JS_IsUndefined(length))
+	{
+		if (value > *count)
+		{
+			JS_ThrowRangeError(ctx, "draw list length %u exceeds its buffer of %u words", value, *count);
+			return NULL;
+		}
+
+		*count = value;
+	}
+
+	return (const uint32_t*)data;
+}
+
+// Strings are converted before the words are resolved and validated: a
+// toString or getter could otherwise rewrite the commands after their check
+int js_rl_execute_draw_commands(JSContext* ctx, JSValueConst commands, JSValueConst length, JSValueConst strings)
+{
+	uint32_t count, text_count;
+
+	if (js_rl_get_draw_string_count(ctx, strings, &text_count))
+		return -1;
+
+	const char** texts = js_rl_get_draw_strings(ctx, strings, text_count);
+
+	if (!texts)
+		return -1;
+
+	const uint32_t* words = js_rl_get_draw_words(ctx, commands, length, &count);
+
+	if (!words || js_rl_check_draw_commands(ctx, words, count, text_count))
+	{
+		js_rl_free_draw_strings(ctx, texts, text_count);
+		return -1;
+	}
+
+	js_rl_run_draw_commands(words, count, texts);
+	js_rl_free_draw_strings(ctx, texts, text_count);
+
+	return 0;
+}
+
+JSValue js_rl_submit_draw_list(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (js_rl_execute_draw_commands(ctx, argv[0], argv[1], argv[2]))
+		return JS_EXCEPTION;
+
+	return JS_UNDEFINED;
+}
+
+#pragma endregion
+#pragma region DisplayList
+
+static void js_rl_display_list_clear(JSRuntime* rt, JSRLDisplayList* p)
+{
+	js_free_rt(rt, p->words);
+	js_free_rt(rt, p->texts);
+
+	p->words = NULL;
+	p->texts = NULL;
+	p->count = 0;
+	p->valid = FALSE;
+}
+
+void js_rl_display_list_finalizer(JSRuntime* rt, JSValue val)
+{
+	JSRLDisplayList* p = (JSRLDisplayList*)JS_GetOpaque(val, js_rl_display_list_class_id);
+
+	if (p)
+	{
+		js_rl_display_list_clear(rt, p);
+		js_free_rt(rt, p);
+	}
+}
+
+JSClassDef js_rl_display_list_class =
+{
+	"DisplayList",
+	.finalizer = js_rl_display_list_finalizer,
+};
+
+static int js_rl_display_list_record(JSContext* ctx, JSRLDisplayList* p, int argc, JSValueConst* argv)
+{
+	uint32_t count, text_count;
+
+	if (js_rl_get_draw_string_count(ctx, argv[2], &text_count))
+		return -1;
+
+	// Strings are copied into one block right after the pointer table so the
+	// list owns everything it needs and replays without touching JS values.
+	// They are converted first since their toString could rewrite the words.
+	const char** strings = js_rl_get_draw_strings(ctx, argv[2], text_count);
+
+	if (!strings)
+		return -1;
+
+	const uint32_t* words = js_rl_get_draw_words(ctx, argv[0], argv[1], &count);
+
+	if (!words)
+	{
+		js_rl_free_draw_strings(ctx, strings, text_count);
+		return -1;
+	}
+
+	size_t text_size = text_count * sizeof(char*);
+
+	for (uint32_t i = 0; i < text_count; i++)
+		text_size += strlen(strings[i]) + 1;
+
+	uint32_t* new_words = js_malloc(ctx, max_int(count, 1) * sizeof(uint32_t));
+	char** new_texts = js_malloc(ctx, max_int(text_size, 1));
+
+	if (!new_words || !new_texts)
+	{
+		js_free(ctx, new_words);
+		js_free(ctx, new_texts);
+		js_rl_free_draw_strings(ctx, strings, text_count);
+		return -1;
+	}
+
+	// Replays trust the stored words, so the copy is what gets validated
+	memcpy(new_words, words, count * sizeof(uint32_t));
+
+	if (js_rl_check_draw_commands(ctx, new_words, count, text_count))
+	{
+		js_free(ctx, new_words);
+		js_free(ctx, new_texts);
+		js_rl_free_draw_strings(ctx, strings, text_count);
+		return -1;
+	}
+
+	char* cursor = (char*)(new_texts + text_count);
+
+	for (uint32_t i = 0; i < text_count; i++)
+	{
+		size_t len = strlen(strings[i]) + 1;
+		memcpy(cursor, strings[i], len);
+		new_texts[i] = cursor;
+		cursor += len;
+	}
+
+	js_rl_free_draw_strings(ctx, strings, text_count);
+	js_rl_display_list_clear(JS_GetRuntime(ctx), p);
+
+	p->words = new_words;
+	p->count = count;
+	p->texts = new_texts;
+	p->valid = TRUE;
+
+	return 0;
+}
+
+JSValue js_rl_display_list_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv)
+{
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_display_list_class_id);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JSRLDisplayList* p = js_mallocz(ctx, sizeof(JSRLDisplayList));
+
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
+
+	JS_SetOpaque(obj, p);
+
+	if (!JS_IsUndefined(argv[0]) && js_rl_display_list_record(ctx, p, argc, argv))
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
+
+	return obj;
+}
+
+JSValue js_rl_display_list_get_valid(JSContext* ctx, JSValueConst this_val)
+{
+	JSRLDisplayList* p = (JSRLDisplayList*)JS_GetOpaque2(ctx, this_val, js_rl_display_list_class_id);
+
+	if (p)
+		return JS_NewBool(ctx, p->valid);
+	else
+		return JS_EXCEPTION;
+}
+
+JSValue js_rl_display_list_get_length(JSContext* ctx, JSValueConst this_val)
+{
+	JSRLDisplayList* p = (JSRLDisplayList*)JS_GetOpaque2(ctx, this_val, js_rl_display_list_class_id);
+
+	if (p)
+		return JS_NewUint32(ctx, p->count);
+	else
+		return JS_EXCEPTION;
+}
+
+JSValue js_rl_display_list_record_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLDisplayList* p = (JSRLDisplayList*)JS_GetOpaque2(ctx, this_val, js_rl_display_list_class_id);
+
+	if (!p)
+		return JS_EXCEPTION;
+
+	if (js_rl_display_list_record(ctx, p, argc, argv))
+		return JS_EXCEPTION;
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_display_list_invalidate(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLDisplayList* p = (JSRLDisplayList*)JS_GetOpaque2(ctx, this_val, js_rl_display_list_class_id);
+
+	if (!p)
+		return JS_EXCEPTION;
+
+	js_rl_display_list_clear(JS_GetRuntime(ctx), p);
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_display_list_draw(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLDisplayList* p = (JSRLDisplayList*)JS_GetOpaque2(ctx, this_val, js_rl_display_list_class_id);
+
+	if (!p)
+		return JS_EXCEPTION;
+
+	// Commands were validated when recorded
+	if (p->valid)
+		js_rl_run_draw_commands(p->words, p->count, (const char* const*)p->texts);
+
+	return JS_NewBool(ctx, p->valid);
+}
+
+const JSCFunctionListEntry js_rl_display_list_proto_funcs[] =
+{
+	JS_CGETSET_DEF("valid", js_rl_display_list_get_valid, NULL),
+	JS_CGETSET_DEF("length", js_rl_display_list_get_length, NULL),
+	JS_CFUNC_DEF("record", 3, js_rl_display_list_record_method),
+	JS_CFUNC_DEF("invalidate", 0, js_rl_display_list_invalidate),
+	JS_CFUNC_DEF("draw", 0, js_rl_display_list_draw),
+};
+
+void js_rl_init_display_list_class(JSContext* ctx, JSModuleDef* m)
+{
+	JSValue proto, obj;
+	JS_NewClassID(&js_rl_display_list_class_id);
+	JS_NewClass(JS_GetRuntime(ctx), js_rl_display_list_class_id, &js_rl_display_list_class);
+	proto = JS_NewObject(ctx);
+	JS_SetPropertyFunctionList(ctx, proto, js_rl_display_list_proto_funcs, countof(js_rl_display_list_proto_funcs));
+	JS_SetClassProto(ctx, js_rl_display_list_class_id, proto);
+
+	obj = JS_NewCFunction2(ctx, js_rl_display_list_constructor, "DisplayList", 3, JS_CFUNC_constructor_or_func, 0);
+	JS_SetModuleExport(ctx, m, "DisplayList", obj);
+}
+
+#pragma endregion
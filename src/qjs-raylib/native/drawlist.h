@@ -0,0 +1,58 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+#include "raylib.h"
+
+#pragma region Draw list
+
+// Command opcodes, must stay in sync with DrawOp in module/drawlist.ts
+typedef enum JSRLDrawOp
+{
+	JS_RL_DRAW_CLEAR = 1,
+	JS_RL_DRAW_PIXEL,
+	JS_RL_DRAW_LINE,
+	JS_RL_DRAW_LINE_EX,
+	JS_RL_DRAW_CIRCLE,
+	JS_RL_DRAW_CIRCLE_LINES,
+	JS_RL_DRAW_RECTANGLE,
+	JS_RL_DRAW_RECTANGLE_LINES,
+	JS_RL_DRAW_RECTANGLE_PRO,
+	JS_RL_DRAW_RECTANGLE_GRADIENT,
+	JS_RL_DRAW_TRIANGLE,
+	JS_RL_DRAW_TRIANGLE_LINES,
+	JS_RL_DRAW_TEXT,
+	JS_RL_DRAW_OP_COUNT,
+} JSRLDrawOp;
+
+int js_rl_execute_draw_commands(JSContext* ctx, JSValueConst commands, JSValueConst length, JSValueConst strings);
+
+JSValue js_rl_submit_draw_list(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
+#pragma region DisplayList
+
+// Validated copy of a draw list that owns its strings and replays without checks
+typedef struct JSRLDisplayList
+{
+	uint32_t* words;
+	uint32_t count;
+	char** texts;
+	BOOL valid;
+} JSRLDisplayList;
+
+JSClassID js_rl_display_list_class_id;
+
+JSValue js_rl_display_list_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst* argv);
+
+void js_rl_init_display_list_class(JSContext* ctx, JSModuleDef* m);
+void js_rl_display_list_finalizer(JSRuntime* rt, JSValue val);
+
+JSValue js_rl_display_list_get_valid(JSContext* ctx, JSValueConst this_val);
+JSValue js_rl_display_list_get_length(JSContext* ctx, JSValueConst this_val);
+JSValue js_rl_display_list_record_method(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_display_list_invalidate(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_display_list_draw(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
@@ -0,0 +1,148 @@
+#include "gc.h"
+#include "raylib.h"
+#include "profiler.h"
+#include "args.h"
+
+#pragma region Garbage collection scheduling
+
+// Frame deadlines belong to the window, so like the profiler the schedule is
+// shared; collections run on the runtime that ends the frame
+static struct
+{
+	BOOL enabled;
+	uint32_t interval;
+	// Seconds per frame raylib waits for, 0 when the frame rate is unlimited
+	double target_frame_time;
+	double frame_start;
+	uint32_t frames_since_gc;
+	// Running average of the collection time, in seconds
+	double estimate;
+	double last;
+	int64_t collections;
+	// Threshold restored after every idle collection, 0 keeps QuickJS's own
+	size_t threshold;
+} js_rl_gc = { .interval = JS_RL_IDLE_GC_DEFAULT_INTERVAL, .estimate = JS_RL_IDLE_GC_INITIAL_ESTIMATE };
+
+void js_rl_gc_set_target_fps(int fps)
+{
+	js_rl_gc.target_frame_time = fps > 0 ? 1.0 / fps : 0.0;
+}
+
+void js_rl_gc_idle(JSRuntime* rt)
+{
+	if (!js_rl_gc.enabled || js_rl_gc.target_frame_time <= 0.0)
+		return;
+
+	if (++js_rl_gc.frames_since_gc < js_rl_gc.interval)
+		return;
+
+	double start = GetTime();
+	double remaining = js_rl_gc.frame_start + js_rl_gc.target_frame_time - start;
+
+	// Keep a margin: a collection that overruns is the spike this avoids
+	if (remaining < js_rl_gc.estimate * 1.5)
+		return;
+
+	js_rl_profile_begin(JS_RL_PHASE_GC);
+	JS_RunGC(rt);
+	js_rl_profile_end(JS_RL_PHASE_GC);
+
+	js_rl_gc.last = GetTime() - start;
+	js_rl_gc.estimate = js_rl_gc.estimate * 0.75 + js_rl_gc.last * 0.25;
+	js_rl_gc.frames_since_gc = 0;
+	js_rl_gc.collections++;
+
+	// An automatic collection in between replaces the threshold with its own.
+	// It is restored relative to the heap that survived, like QuickJS does:
+	// a threshold below the live heap would start a collection mid-frame on
+	// the next allocation.
+	if (js_rl_gc.threshold)
+	{
+		JSMemoryUsage usage;
+		JS_ComputeMemoryUsage(rt, &usage);
+
+		size_t floor = (size_t)usage.malloc_size + (size_t)usage.malloc_size / 2;
+		JS_SetGCThreshold(rt, js_rl_gc.threshold > floor ? js_rl_gc.threshold : floor);
+	}
+}
+
+void js_rl_gc_frame_start(void)
+{
+	if (js_rl_gc.enabled)
+		js_rl_gc.frame_start = GetTime();
+}
+
+JSValue js_rl_set_idle_gc(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int enabled = JS_ToBool(ctx, argv[0]);
+	uint32_t interval = JS_RL_IDLE_GC_DEFAULT_INTERVAL;
+
+	if (enabled < 0)
+		return JS_EXCEPTION;
+
+	if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_RL_TO_UINT32(ctx, &interval, argv[1]))
+		return JS_EXCEPTION;
+
+	js_rl_gc.enabled = enabled;
+	js_rl_gc.interval = max_int(interval, 1);
+	js_rl_gc.frames_since_gc = 0;
+	js_rl_gc.frame_start = GetTime();
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_set_gc_threshold(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int64_t threshold;
+
+	if (JS_RL_TO_INT64(ctx, &threshold, argv[0]))
+		return JS_EXCEPTION;
+
+	if (threshold <= 0)
+		return JS_ThrowRangeError(ctx, "the GC threshold must be positive");
+
+	js_rl_gc.threshold = threshold;
+	JS_SetGCThreshold(JS_GetRuntime(ctx), threshold);
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_get_heap_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSMemoryUsage usage;
+	JS_ComputeMemoryUsage(JS_GetRuntime(ctx), &usage);
+
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "mallocSize", JS_NewInt64(ctx, usage.malloc_size));
+	JS_SetPropertyStr(ctx, obj, "mallocCount", JS_NewInt64(ctx, usage.malloc_count));
+	JS_SetPropertyStr(ctx, obj, "mallocLimit", JS_NewInt64(ctx, usage.malloc_limit));
+	JS_SetPropertyStr(ctx, obj, "memoryUsedSize", JS_NewInt64(ctx, usage.memory_used_size));
+	JS_SetPropertyStr(ctx, obj, "memoryUsedCount", JS_NewInt64(ctx, usage.memory_used_count));
+	JS_SetPropertyStr(ctx, obj, "atomCount", JS_NewInt64(ctx, usage.atom_count));
+	JS_SetPropertyStr(ctx, obj, "atomSize", JS_NewInt64(ctx, usage.atom_size));
+	JS_SetPropertyStr(ctx, obj, "stringCount", JS_NewInt64(ctx, usage.str_count));
+	JS_SetPropertyStr(ctx, obj, "stringSize", JS_NewInt64(ctx, usage.str_size));
+	JS_SetPropertyStr(ctx, obj, "objectCount", JS_NewInt64(ctx, usage.obj_count));
+	JS_SetPropertyStr(ctx, obj, "objectSize", JS_NewInt64(ctx, usage.obj_size));
+	JS_SetPropertyStr(ctx, obj, "propertyCount", JS_NewInt64(ctx, usage.prop_count));
+	JS_SetPropertyStr(ctx, obj, "propertySize", JS_NewInt64(ctx, usage.prop_size));
+	JS_SetPropertyStr(ctx, obj, "shapeCount", JS_NewInt64(ctx, usage.shape_count));
+	JS_SetPropertyStr(ctx, obj, "shapeSize", JS_NewInt64(ctx, usage.shape_size));
+	JS_SetPropertyStr(ctx, obj, "functionCount", JS_NewInt64(ctx, usage.js_func_count));
+	JS_SetPropertyStr(ctx, obj, "functionSize", JS_NewInt64(ctx, usage.js_func_size));
+	JS_SetPropertyStr(ctx, obj, "arrayCount", JS_NewInt64(ctx, usage.array_count));
+	JS_SetPropertyStr(ctx, obj, "fastArrayCount", JS_NewInt64(ctx, usage.fast_array_count));
+	JS_SetPropertyStr(ctx, obj, "binaryObjectCount", JS_NewInt64(ctx, usage.binary_object_count));
+	JS_SetPropertyStr(ctx, obj, "binaryObjectSize", JS_NewInt64(ctx, usage.binary_object_size));
+	JS_SetPropertyStr(ctx, obj, "idleCollections", JS_NewInt64(ctx, js_rl_gc.collections));
+	JS_SetPropertyStr(ctx, obj, "lastCollectionTime", JS_NewFloat64(ctx, js_rl_gc.last * 1000.0));
+	JS_SetPropertyStr(ctx, obj, "estimatedCollectionTime", JS_NewFloat64(ctx, js_rl_gc.estimate * 1000.0));
+
+	return obj;
+}
+
+#pragma endregion
@@ -0,0 +1,26 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+
+#pragma region Garbage collection scheduling
+
+// Frames to wait between two idle collections, unless set by setIdleGc()
+#define JS_RL_IDLE_GC_DEFAULT_INTERVAL 30
+// Assumed cost of a collection before one has been timed, in seconds
+#define JS_RL_IDLE_GC_INITIAL_ESTIMATE 0.001
+
+// Remembers the frame rate raylib waits for, see setTargetFps()
+void js_rl_gc_set_target_fps(int fps);
+// Called right before EndDrawing(): collects when the frame is early enough
+// to absorb a collection before its deadline
+void js_rl_gc_idle(JSRuntime* rt);
+// Called right after EndDrawing(), when the next frame starts
+void js_rl_gc_frame_start(void);
+
+JSValue js_rl_set_idle_gc(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_set_gc_threshold(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_heap_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
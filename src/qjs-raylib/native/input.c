@@ -0,0 +1,819 @@
+#include "GLFW/glfw3.h"
+
+#include "time.h"
+
+#include "input.h"
+#include "structs.h"
+#include "strcache.h"
+#include "args.h"
+
+#pragma region Input state
+
+static const JSRLInputFrame* js_rl_replayed_frame(void);
+
+_Static_assert(sizeof(JSRLInputState) == 548, "JSRLInputState layout changed, update InputLayout in module/input.ts");
+
+static void js_rl_set_bit(uint8_t* bits, int n, bool value)
+{
+	if (value)
+		bits[n >> 3] |= 1 << (n & 7);
+}
+
+void js_rl_capture_input(JSRLInputState* state)
+{
+	memset(state, 0, sizeof(JSRLInputState));
+
+	for (int key = 0; key < JS_RL_INPUT_KEYS; key++)
+	{
+		js_rl_set_bit(state->keys_down, key, IsKeyDown(key));
+		js_rl_set_bit(state->keys_pressed, key, IsKeyPressed(key));
+		js_rl_set_bit(state->keys_released, key, IsKeyReleased(key));
+	}
+
+	state->key_pressed = GetKeyPressed();
+
+	state->mouse_position = GetMousePosition();
+	state->mouse_wheel = GetMouseWheelMove();
+
+	for (int button = 0; button < JS_RL_INPUT_MOUSE_BUTTONS; button++)
+	{
+		state->mouse_down |= (uint32_t)IsMouseButtonDown(button) << button;
+		state->mouse_pressed |= (uint32_t)IsMouseButtonPressed(button) << button;
+		state->mouse_released |= (uint32_t)IsMouseButtonReleased(button) << button;
+	}
+
+	state->touch_count = min_int(GetTouchPointsCount(), JS_RL_INPUT_TOUCH_POINTS);
+
+	for (int i = 0; i < state->touch_count; i++)
+		state->touch[i] = GetTouchPosition(i);
+
+	state->gesture = GetGestureDetected();
+	state->gesture_hold_duration = GetGestureHoldDuration();
+	state->gesture_drag_vector = GetGestureDragVector();
+	state->gesture_drag_angle = GetGestureDragAngle();
+	state->gesture_pinch_vector = GetGesturePinchVector();
+	state->gesture_pinch_angle = GetGesturePinchAngle();
+
+	state->gamepad_button_pressed = GetGamepadButtonPressed();
+
+	for (int gamepad = 0; gamepad < JS_RL_INPUT_GAMEPADS; gamepad++)
+	{
+		JSRLGamepadState* pad = &state->gamepads[gamepad];
+
+		if (!IsGamepadAvailable(gamepad))
+			continue;
+
+		pad->available = 1;
+		pad->axis_count = min_int(GetGamepadAxisCount(gamepad), JS_RL_INPUT_GAMEPAD_AXES);
+
+		for (uint32_t axis = 0; axis < pad->axis_count; axis++)
+			pad->axes[axis] = GetGamepadAxisMovement(gamepad, axis);
+
+		for (int button = 0; button < JS_RL_INPUT_GAMEPAD_BUTTONS; button++)
+		{
+			pad->buttons_down |= (uint32_t)IsGamepadButtonDown(gamepad, button) << button;
+			pad->buttons_pressed |= (uint32_t)IsGamepadButtonPressed(gamepad, button) << button;
+			pad->buttons_released |= (uint32_t)IsGamepadButtonReleased(gamepad, button) << button;
+		}
+	}
+}
+
+JSValue js_rl_poll_input(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLInputState state;
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+
+	if (frame)
+		state = frame->state;
+	else
+		js_rl_capture_input(&state);
+
+	// Without a destination a new ArrayBuffer is returned
+	if (argc < 1 || JS_IsUndefined(argv[0]))
+	{
+		JSValue buffer = js_rl_new_array_buffer(ctx, sizeof(JSRLInputState));
+
+		if (JS_IsException(buffer))
+			return buffer;
+
+		size_t size;
+		memcpy(JS_GetArrayBuffer(ctx, &size, buffer), &state, sizeof(JSRLInputState));
+
+		return buffer;
+	}
+
+	size_t size;
+	uint8_t* data = js_rl_get_array_buffer(ctx, argv[0], &size);
+
+	if (!data)
+		return JS_EXCEPTION;
+
+	if (size < sizeof(JSRLInputState))
+		return JS_ThrowRangeError(ctx, "input state needs %u bytes, buffer holds %u", (unsigned)sizeof(JSRLInputState), (unsigned)size);
+
+	memcpy(data, &state, sizeof(JSRLInputState));
+
+	return JS_DupValue(ctx, argv[0]);
+}
+
+#pragma endregion
+#pragma region Input events
+
+_Static_assert(sizeof(JSRLInputEvent) == 24, "JSRLInputEvent layout changed, update InputEventLayout in module/input.ts");
+
+// raylib handles a single window whose GLFW callbacks run on the main thread
+// while EndDrawing() polls events, so the queue is a plain global ring. The
+// callbacks raylib installed are kept and still called first.
+static struct
+{
+	JSRLInputEvent events[JS_RL_INPUT_EVENT_CAPACITY];
+	uint32_t head;
+	uint32_t count;
+	int64_t total;
+	int64_t dropped;
+	GLFWwindow* window;
+	GLFWkeyfun key;
+	GLFWcharfun character;
+	GLFWmousebuttonfun mouse_button;
+	GLFWcursorposfun cursor_pos;
+	GLFWscrollfun scroll;
+	// Gamepads have no GLFW callbacks: they are diffed once per frame
+	uint32_t gamepad_buttons[JS_RL_INPUT_GAMEPADS];
+	float gamepad_axes[JS_RL_INPUT_GAMEPADS][JS_RL_INPUT_GAMEPAD_AXES];
+} js_rl_input_events;
+
+static void js_rl_push_input_event(uint8_t type, uint8_t device, int mods, int code, float x, float y)
+{
+	// A full queue drops its oldest event
+	if (js_rl_input_events.count == JS_RL_INPUT_EVENT_CAPACITY)
+	{
+		js_rl_input_events.head = (js_rl_input_events.head + 1) % JS_RL_INPUT_EVENT_CAPACITY;
+		js_rl_input_events.count--;
+		js_rl_input_events.dropped++;
+	}
+
+	uint32_t tail = (js_rl_input_events.head + js_rl_input_events.count) % JS_RL_INPUT_EVENT_CAPACITY;
+
+	js_rl_input_events.events[tail] = (JSRLInputEvent){ glfwGetTime(), type, device, (uint16_t)mods, code, x, y };
+	js_rl_input_events.count++;
+	js_rl_input_events.total++;
+}
+
+static void js_rl_key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+	if (js_rl_input_events.key)
+		js_rl_input_events.key(window, key, scancode, action, mods);
+
+	uint8_t type = action == GLFW_PRESS ? JS_RL_INPUT_EVENT_KEY_DOWN : action == GLFW_RELEASE ? JS_RL_INPUT_EVENT_KEY_UP : JS_RL_INPUT_EVENT_KEY_REPEAT;
+	js_rl_push_input_event(type, 0, mods, key, 0.0f, 0.0f);
+}
+
+static void js_rl_char_callback(GLFWwindow* window, unsigned int codepoint)
+{
+	if (js_rl_input_events.character)
+		js_rl_input_events.character(window, codepoint);
+
+	js_rl_push_input_event(JS_RL_INPUT_EVENT_CHAR, 0, 0, (int)codepoint, 0.0f, 0.0f);
+}
+
+static void js_rl_mouse_button_callback(GLFWwindow* window, int button, int action, int mods)
+{
+	if (js_rl_input_events.mouse_button)
+		js_rl_input_events.mouse_button(window, button, action, mods);
+
+	double x, y;
+	glfwGetCursorPos(window, &x, &y);
+
+	uint8_t type = action == GLFW_PRESS ? JS_RL_INPUT_EVENT_MOUSE_DOWN : JS_RL_INPUT_EVENT_MOUSE_UP;
+	js_rl_push_input_event(type, 0, mods, button, (float)x, (float)y);
+}
+
+static void js_rl_cursor_pos_callback(GLFWwindow* window, double x, double y)
+{
+	if (js_rl_input_events.cursor_pos)
+		js_rl_input_events.cursor_pos(window, x, y);
+
+	// Window coordinates, setMouseOffset()/setMouseScale() only apply to polled positions
+	js_rl_push_input_event(JS_RL_INPUT_EVENT_MOUSE_MOVE, 0, 0, 0, (float)x, (float)y);
+}
+
+static void js_rl_scroll_callback(GLFWwindow* window, double x, double y)
+{
+	if (js_rl_input_events.scroll)
+		js_rl_input_events.scroll(window, x, y);
+
+	js_rl_push_input_event(JS_RL_INPUT_EVENT_MOUSE_WHEEL, 0, 0, 0, (float)x, (float)y);
+}
+
+void js_rl_input_events_frame(void)
+{
+	if (!js_rl_input_events.window)
+		return;
+
+	for (int gamepad = 0; gamepad < JS_RL_INPUT_GAMEPADS; gamepad++)
+	{
+		BOOL available = IsGamepadAvailable(gamepad);
+		uint32_t buttons = 0;
+
+		for (int button = 0; available && button < JS_RL_INPUT_GAMEPAD_BUTTONS; button++)
+			buttons |= (uint32_t)IsGamepadButtonDown(gamepad, button) << button;
+
+		uint32_t changed = buttons ^ js_rl_input_events.gamepad_buttons[gamepad];
+
+		for (int button = 0; changed; button++, changed >>= 1)
+		{
+			if (changed & 1)
+				js_rl_push_input_event((buttons >> button) & 1 ? JS_RL_INPUT_EVENT_GAMEPAD_DOWN : JS_RL_INPUT_EVENT_GAMEPAD_UP, gamepad, 0, button, 0.0f, 0.0f);
+		}
+
+		js_rl_input_events.gamepad_buttons[gamepad] = buttons;
+
+		int axis_count = available ? min_int(GetGamepadAxisCount(gamepad), JS_RL_INPUT_GAMEPAD_AXES) : 0;
+
+		for (int axis = 0; axis < JS_RL_INPUT_GAMEPAD_AXES; axis++)
+		{
+			float value = axis < axis_count ? GetGamepadAxisMovement(gamepad, axis) : 0.0f;
+
+			if (value != js_rl_input_events.gamepad_axes[gamepad][axis])
+			{
+				js_rl_push_input_event(JS_RL_INPUT_EVENT_GAMEPAD_AXIS, gamepad, 0, axis, value, 0.0f);
+				js_rl_input_events.gamepad_axes[gamepad][axis] = value;
+			}
+		}
+	}
+}
+
+static void js_rl_uninstall_input_callbacks(void)
+{
+	GLFWwindow* window = js_rl_input_events.window;
+
+	glfwSetKeyCallback(window, js_rl_input_events.key);
+	glfwSetCharCallback(window, js_rl_input_events.character);
+	glfwSetMouseButtonCallback(window, js_rl_input_events.mouse_button);
+	glfwSetCursorPosCallback(window, js_rl_input_events.cursor_pos);
+	glfwSetScrollCallback(window, js_rl_input_events.scroll);
+}
+
+void js_rl_input_events_close(void)
+{
+	// The window and its callbacks are gone, only forget about them
+	memset(&js_rl_input_events, 0, sizeof(js_rl_input_events));
+}
+
+JSValue js_rl_set_input_events(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	BOOL enabled = JS_ToBool(ctx, argv[0]);
+
+	if (enabled == (js_rl_input_events.window != NULL))
+		return JS_UNDEFINED;
+
+	if (enabled)
+	{
+		GLFWwindow* window = glfwGetCurrentContext();
+
+		if (!window)
+			return JS_ThrowInternalError(ctx, "input events need an open window");
+
+		js_rl_input_events.window = window;
+		js_rl_input_events.key = glfwSetKeyCallback(window, js_rl_key_callback);
+		js_rl_input_events.character = glfwSetCharCallback(window, js_rl_char_callback);
+		js_rl_input_events.mouse_button = glfwSetMouseButtonCallback(window, js_rl_mouse_button_callback);
+		js_rl_input_events.cursor_pos = glfwSetCursorPosCallback(window, js_rl_cursor_pos_callback);
+		js_rl_input_events.scroll = glfwSetScrollCallback(window, js_rl_scroll_callback);
+	}
+	else
+	{
+		js_rl_uninstall_input_callbacks();
+		js_rl_input_events_close();
+	}
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_drain_input_events(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	size_t size;
+	uint8_t* data = js_rl_get_array_buffer(ctx, argv[0], &size);
+
+	if (!data)
+		return JS_EXCEPTION;
+
+	// Events that don't fit stay queued for the next call
+	uint32_t count = min_int(js_rl_input_events.count, size / sizeof(JSRLInputEvent));
+	uint32_t first = min_int(count, JS_RL_INPUT_EVENT_CAPACITY - js_rl_input_events.head);
+
+	memcpy(data, js_rl_input_events.events + js_rl_input_events.head, first * sizeof(JSRLInputEvent));
+	memcpy(data + first * sizeof(JSRLInputEvent), js_rl_input_events.events, (count - first) * sizeof(JSRLInputEvent));
+
+	js_rl_input_events.head = (js_rl_input_events.head + count) % JS_RL_INPUT_EVENT_CAPACITY;
+	js_rl_input_events.count -= count;
+
+	return JS_NewUint32(ctx, count);
+}
+
+JSValue js_rl_get_input_event_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "enabled", JS_NewBool(ctx, js_rl_input_events.window != NULL));
+	JS_SetPropertyStr(ctx, obj, "queued", JS_NewUint32(ctx, js_rl_input_events.count));
+	JS_SetPropertyStr(ctx, obj, "capacity", JS_NewUint32(ctx, JS_RL_INPUT_EVENT_CAPACITY));
+	JS_SetPropertyStr(ctx, obj, "total", JS_NewInt64(ctx, js_rl_input_events.total));
+	JS_SetPropertyStr(ctx, obj, "dropped", JS_NewInt64(ctx, js_rl_input_events.dropped));
+
+	return obj;
+}
+
+#pragma endregion
+#pragma region Input recording
+
+_Static_assert(sizeof(JSRLInputFrame) == 560, "JSRLInputFrame layout changed, bump JS_RL_INPUT_RECORDING_VERSION");
+
+typedef enum JSRLInputRecordingMode
+{
+	JS_RL_INPUT_LIVE,
+	JS_RL_INPUT_RECORD,
+	JS_RL_INPUT_REPLAY,
+} JSRLInputRecordingMode;
+
+// Recording keeps frames in memory and writes them out when it stops, so
+// timing runs don't pay for file I/O every frame
+static struct
+{
+	JSRLInputRecordingMode mode;
+	char* file_name;
+	uint32_t seed;
+	JSRLInputFrame* frames;
+	uint32_t count;
+	uint32_t capacity;
+	// Frame being replayed
+	uint32_t cursor;
+} js_rl_input_recording;
+
+enum { JS_RL_GAMEPAD_DOWN, JS_RL_GAMEPAD_PRESSED, JS_RL_GAMEPAD_RELEASED };
+
+static const JSRLInputFrame* js_rl_replayed_frame(void)
+{
+	if (js_rl_input_recording.mode != JS_RL_INPUT_REPLAY)
+		return NULL;
+
+	return &js_rl_input_recording.frames[js_rl_input_recording.cursor];
+}
+
+static bool js_rl_get_bit(const uint8_t* bits, int n)
+{
+	return n >= 0 && n < JS_RL_INPUT_KEYS && (bits[n >> 3] & (1 << (n & 7)));
+}
+
+static bool js_rl_get_mask_bit(uint32_t mask, int n)
+{
+	return n >= 0 && n < 32 && (mask & (1u << n));
+}
+
+static const JSRLGamepadState* js_rl_replayed_gamepad(const JSRLInputFrame* frame, int gamepad)
+{
+	if (gamepad < 0 || gamepad >= JS_RL_INPUT_GAMEPADS || !frame->state.gamepads[gamepad].available)
+		return NULL;
+
+	return &frame->state.gamepads[gamepad];
+}
+
+static bool js_rl_get_gamepad_bit(const JSRLInputFrame* frame, int gamepad, int which, int button)
+{
+	const JSRLGamepadState* pad = js_rl_replayed_gamepad(frame, gamepad);
+
+	if (!pad)
+		return false;
+
+	uint32_t mask = which == JS_RL_GAMEPAD_DOWN ? pad->buttons_down : which == JS_RL_GAMEPAD_PRESSED ? pad->buttons_pressed : pad->buttons_released;
+
+	return js_rl_get_mask_bit(mask, button);
+}
+
+bool js_rl_is_key_pressed(int key)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_bit(frame->state.keys_pressed, key) : IsKeyPressed(key);
+}
+
+bool js_rl_is_key_down(int key)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_bit(frame->state.keys_down, key) : IsKeyDown(key);
+}
+
+bool js_rl_is_key_released(int key)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_bit(frame->state.keys_released, key) : IsKeyReleased(key);
+}
+
+bool js_rl_is_key_up(int key)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? !js_rl_get_bit(frame->state.keys_down, key) : IsKeyUp(key);
+}
+
+int js_rl_get_key_pressed(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.key_pressed : GetKeyPressed();
+}
+
+bool js_rl_is_gamepad_available(int gamepad)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_replayed_gamepad(frame, gamepad) != NULL : IsGamepadAvailable(gamepad);
+}
+
+bool js_rl_is_gamepad_button_pressed(int gamepad, int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_gamepad_bit(frame, gamepad, JS_RL_GAMEPAD_PRESSED, button) : IsGamepadButtonPressed(gamepad, button);
+}
+
+bool js_rl_is_gamepad_button_down(int gamepad, int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_gamepad_bit(frame, gamepad, JS_RL_GAMEPAD_DOWN, button) : IsGamepadButtonDown(gamepad, button);
+}
+
+bool js_rl_is_gamepad_button_released(int gamepad, int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_gamepad_bit(frame, gamepad, JS_RL_GAMEPAD_RELEASED, button) : IsGamepadButtonReleased(gamepad, button);
+}
+
+bool js_rl_is_gamepad_button_up(int gamepad, int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_replayed_gamepad(frame, gamepad) && !js_rl_get_gamepad_bit(frame, gamepad, JS_RL_GAMEPAD_DOWN, button) : IsGamepadButtonUp(gamepad, button);
+}
+
+int js_rl_get_gamepad_button_pressed(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gamepad_button_pressed : GetGamepadButtonPressed();
+}
+
+int js_rl_get_gamepad_axis_count(int gamepad)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_replayed_gamepad(frame, gamepad) ? (int)frame->state.gamepads[gamepad].axis_count : 0 : GetGamepadAxisCount(gamepad);
+}
+
+float js_rl_get_gamepad_axis_movement(int gamepad, int axis)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_replayed_gamepad(frame, gamepad) && axis >= 0 && axis < JS_RL_INPUT_GAMEPAD_AXES ? frame->state.gamepads[gamepad].axes[axis] : 0.0f : GetGamepadAxisMovement(gamepad, axis);
+}
+
+bool js_rl_is_mouse_button_pressed(int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_mask_bit(frame->state.mouse_pressed, button) : IsMouseButtonPressed(button);
+}
+
+bool js_rl_is_mouse_button_down(int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_mask_bit(frame->state.mouse_down, button) : IsMouseButtonDown(button);
+}
+
+bool js_rl_is_mouse_button_released(int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? js_rl_get_mask_bit(frame->state.mouse_released, button) : IsMouseButtonReleased(button);
+}
+
+bool js_rl_is_mouse_button_up(int button)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? !js_rl_get_mask_bit(frame->state.mouse_down, button) : IsMouseButtonUp(button);
+}
+
+int js_rl_get_mouse_x(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? (int)frame->state.mouse_position.x : GetMouseX();
+}
+
+int js_rl_get_mouse_y(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? (int)frame->state.mouse_position.y : GetMouseY();
+}
+
+Vector2 js_rl_get_mouse_position(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.mouse_position : GetMousePosition();
+}
+
+int js_rl_get_mouse_wheel_move(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.mouse_wheel : GetMouseWheelMove();
+}
+
+int js_rl_get_touch_x(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? (int)frame->state.touch[0].x : GetTouchX();
+}
+
+int js_rl_get_touch_y(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? (int)frame->state.touch[0].y : GetTouchY();
+}
+
+Vector2 js_rl_get_touch_position(int index)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? index >= 0 && index < JS_RL_INPUT_TOUCH_POINTS ? frame->state.touch[index] : (Vector2){ -1.0f, -1.0f } : GetTouchPosition(index);
+}
+
+bool js_rl_is_gesture_detected(int gesture)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture == gesture : IsGestureDetected(gesture);
+}
+
+int js_rl_get_gesture_detected(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture : GetGestureDetected();
+}
+
+int js_rl_get_touch_points_count(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.touch_count : GetTouchPointsCount();
+}
+
+float js_rl_get_gesture_hold_duration(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture_hold_duration : GetGestureHoldDuration();
+}
+
+Vector2 js_rl_get_gesture_drag_vector(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture_drag_vector : GetGestureDragVector();
+}
+
+float js_rl_get_gesture_drag_angle(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture_drag_angle : GetGestureDragAngle();
+}
+
+Vector2 js_rl_get_gesture_pinch_vector(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture_pinch_vector : GetGesturePinchVector();
+}
+
+float js_rl_get_gesture_pinch_angle(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->state.gesture_pinch_angle : GetGesturePinchAngle();
+}
+
+double js_rl_get_time(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->time : GetTime();
+}
+
+float js_rl_get_frame_time(void)
+{
+	const JSRLInputFrame* frame = js_rl_replayed_frame();
+	return frame ? frame->frame_time : GetFrameTime();
+}
+
+BOOL js_rl_is_replaying_input(void)
+{
+	return js_rl_input_recording.mode == JS_RL_INPUT_REPLAY;
+}
+
+static BOOL js_rl_record_input_frame(void)
+{
+	if (js_rl_input_recording.count == js_rl_input_recording.capacity)
+	{
+		uint32_t capacity = max_int(js_rl_input_recording.capacity * 2, 1024);
+		JSRLInputFrame* frames = realloc(js_rl_input_recording.frames, capacity * sizeof(JSRLInputFrame));
+
+		if (!frames)
+			return FALSE;
+
+		js_rl_input_recording.frames = frames;
+		js_rl_input_recording.capacity = capacity;
+	}
+
+	JSRLInputFrame* frame = &js_rl_input_recording.frames[js_rl_input_recording.count++];
+	frame->time = GetTime();
+	frame->frame_time = GetFrameTime();
+	js_rl_capture_input(&frame->state);
+
+	return TRUE;
+}
+
+static void js_rl_reset_input_recording(void)
+{
+	free(js_rl_input_recording.file_name);
+	free(js_rl_input_recording.frames);
+	memset(&js_rl_input_recording, 0, sizeof(js_rl_input_recording));
+}
+
+static BOOL js_rl_write_input_recording(void)
+{
+	FILE* file = fopen(js_rl_input_recording.file_name, "wb");
+
+	if (!file)
+		return FALSE;
+
+	JSRLInputRecordingHeader header =
+	{
+		JS_RL_INPUT_RECORDING_MAGIC,
+		JS_RL_INPUT_RECORDING_VERSION,
+		sizeof(JSRLInputFrame),
+		js_rl_input_recording.seed,
+	};
+
+	BOOL ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+		fwrite(js_rl_input_recording.frames, sizeof(JSRLInputFrame), js_rl_input_recording.count, file) == js_rl_input_recording.count;
+
+	return fclose(file) == 0 && ok;
+}
+
+void js_rl_input_recording_frame(void)
+{
+	switch (js_rl_input_recording.mode)
+	{
+		case JS_RL_INPUT_RECORD:
+			// Out of memory: write out what has been recorded so far and go
+			// back to live input, leaving nothing behind for a new recording
+			if (!js_rl_record_input_frame())
+			{
+				js_rl_write_input_recording();
+				js_rl_reset_input_recording();
+			}
+			break;
+
+		case JS_RL_INPUT_REPLAY:
+			// Back to live input once the recording is exhausted
+			if (++js_rl_input_recording.cursor >= js_rl_input_recording.count)
+				js_rl_reset_input_recording();
+			break;
+
+		default:
+			break;
+	}
+}
+
+void js_rl_input_recording_close(void)
+{
+	if (js_rl_input_recording.file_name && js_rl_input_recording.frames && js_rl_input_recording.mode != JS_RL_INPUT_REPLAY)
+		js_rl_write_input_recording();
+
+	js_rl_reset_input_recording();
+}
+
+JSValue js_rl_start_input_recording(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t seed = (uint32_t)time(NULL);
+
+	// The seed's valueOf may start a recording or fill the string cache, so
+	// the state is checked and the file name fetched afterwards
+	if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_RL_TO_UINT32(ctx, &seed, argv[1]))
+		return JS_EXCEPTION;
+
+	if (js_rl_input_recording.mode != JS_RL_INPUT_LIVE)
+		return JS_ThrowInternalError(ctx, "input is already being recorded or replayed");
+
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (!fileName)
+		return JS_EXCEPTION;
+
+	js_rl_input_recording.file_name = strdup(fileName);
+
+	if (!js_rl_input_recording.file_name || !js_rl_record_input_frame())
+	{
+		js_rl_reset_input_recording();
+		return JS_ThrowOutOfMemory(ctx);
+	}
+
+	js_rl_input_recording.mode = JS_RL_INPUT_RECORD;
+	js_rl_input_recording.seed = seed;
+	srand(seed);
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_stop_input_recording(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (js_rl_input_recording.mode != JS_RL_INPUT_RECORD)
+		return JS_ThrowInternalError(ctx, "input is not being recorded");
+
+	uint32_t count = js_rl_input_recording.count;
+	BOOL written = js_rl_write_input_recording();
+
+	if (!written)
+		JS_ThrowInternalError(ctx, "cannot write input recording to %s", js_rl_input_recording.file_name);
+
+	js_rl_reset_input_recording();
+
+	return written ? JS_NewUint32(ctx, count) : JS_EXCEPTION;
+}
+
+JSValue js_rl_start_input_replay(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (js_rl_input_recording.mode != JS_RL_INPUT_LIVE)
+		return JS_ThrowInternalError(ctx, "input is already being recorded or replayed");
+
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (!fileName)
+		return JS_EXCEPTION;
+
+	FILE* file = fopen(fileName, "rb");
+
+	if (!file)
+		return JS_ThrowInternalError(ctx, "cannot open input recording %s", fileName);
+
+	JSRLInputRecordingHeader header;
+	long size = -1;
+
+	if (fread(&header, sizeof(header), 1, file) == 1 && fseek(file, 0, SEEK_END) == 0)
+		size = ftell(file) - (long)sizeof(header);
+
+	if (size <= 0 || header.magic != JS_RL_INPUT_RECORDING_MAGIC || header.version != JS_RL_INPUT_RECORDING_VERSION ||
+		header.frame_size != sizeof(JSRLInputFrame) || size % sizeof(JSRLInputFrame) != 0)
+	{
+		fclose(file);
+		return JS_ThrowTypeError(ctx, "%s is not an input recording", fileName);
+	}
+
+	uint32_t count = size / sizeof(JSRLInputFrame);
+	JSRLInputFrame* frames = malloc(size);
+
+	if (!frames)
+	{
+		fclose(file);
+		return JS_ThrowOutOfMemory(ctx);
+	}
+
+	BOOL ok = fseek(file, sizeof(header), SEEK_SET) == 0 && fread(frames, sizeof(JSRLInputFrame), count, file) == count;
+	fclose(file);
+
+	if (!ok)
+	{
+		free(frames);
+		return JS_ThrowInternalError(ctx, "cannot read input recording %s", fileName);
+	}
+
+	js_rl_input_recording.mode = JS_RL_INPUT_REPLAY;
+	js_rl_input_recording.seed = header.seed;
+	js_rl_input_recording.frames = frames;
+	js_rl_input_recording.count = count;
+	js_rl_input_recording.capacity = count;
+	js_rl_input_recording.cursor = 0;
+	srand(header.seed);
+
+	return JS_NewUint32(ctx, count);
+}
+
+JSValue js_rl_stop_input_replay(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (js_rl_input_recording.mode == JS_RL_INPUT_REPLAY)
+		js_rl_reset_input_recording();
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_get_input_recording_state(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	BOOL replaying = js_rl_input_recording.mode == JS_RL_INPUT_REPLAY;
+
+	JS_SetPropertyStr(ctx, obj, "recording", JS_NewBool(ctx, js_rl_input_recording.mode == JS_RL_INPUT_RECORD));
+	JS_SetPropertyStr(ctx, obj, "replaying", JS_NewBool(ctx, replaying));
+	JS_SetPropertyStr(ctx, obj, "frame", JS_NewUint32(ctx, replaying ? js_rl_input_recording.cursor : js_rl_input_recording.count));
+	JS_SetPropertyStr(ctx, obj, "frames", JS_NewUint32(ctx, js_rl_input_recording.count));
+	JS_SetPropertyStr(ctx, obj, "seed", JS_NewUint32(ctx, js_rl_input_recording.seed));
+
+	return obj;
+}
+
+#pragma endregion
@@ -0,0 +1,180 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+#include "raylib.h"
+
+#pragma region Input state
+
+#define JS_RL_INPUT_KEYS 512
+#define JS_RL_INPUT_MOUSE_BUTTONS 3
+#define JS_RL_INPUT_TOUCH_POINTS 10
+#define JS_RL_INPUT_GAMEPADS 4
+#define JS_RL_INPUT_GAMEPAD_BUTTONS 32
+#define JS_RL_INPUT_GAMEPAD_AXES 8
+
+// Layout written by pollInput(), must stay in sync with InputLayout in
+// module/input.ts. Every field is 4-byte aligned so the buffer can be read
+// through Int32Array/Float32Array views; key bitsets hold key n at bit n % 8
+// of byte n / 8.
+typedef struct JSRLGamepadState
+{
+	uint32_t available;
+	uint32_t axis_count;
+	// Bit n is button n
+	uint32_t buttons_down;
+	uint32_t buttons_pressed;
+	uint32_t buttons_released;
+	float axes[JS_RL_INPUT_GAMEPAD_AXES];
+} JSRLGamepadState;
+
+typedef struct JSRLInputState
+{
+	uint8_t keys_down[JS_RL_INPUT_KEYS / 8];
+	uint8_t keys_pressed[JS_RL_INPUT_KEYS / 8];
+	uint8_t keys_released[JS_RL_INPUT_KEYS / 8];
+	int32_t key_pressed;
+	Vector2 mouse_position;
+	int32_t mouse_wheel;
+	// Bit n is mouse button n
+	uint32_t mouse_down;
+	uint32_t mouse_pressed;
+	uint32_t mouse_released;
+	int32_t touch_count;
+	Vector2 touch[JS_RL_INPUT_TOUCH_POINTS];
+	int32_t gesture;
+	float gesture_hold_duration;
+	Vector2 gesture_drag_vector;
+	float gesture_drag_angle;
+	Vector2 gesture_pinch_vector;
+	float gesture_pinch_angle;
+	int32_t gamepad_button_pressed;
+	JSRLGamepadState gamepads[JS_RL_INPUT_GAMEPADS];
+} JSRLInputState;
+
+void js_rl_capture_input(JSRLInputState* state);
+
+JSValue js_rl_poll_input(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
+#pragma region Input events
+
+#define JS_RL_INPUT_EVENT_CAPACITY 1024
+
+// Must stay in sync with InputEventType in module/input.ts
+typedef enum JSRLInputEventType
+{
+	JS_RL_INPUT_EVENT_KEY_DOWN = 1,
+	JS_RL_INPUT_EVENT_KEY_UP,
+	JS_RL_INPUT_EVENT_KEY_REPEAT,
+	JS_RL_INPUT_EVENT_CHAR,
+	JS_RL_INPUT_EVENT_MOUSE_MOVE,
+	JS_RL_INPUT_EVENT_MOUSE_DOWN,
+	JS_RL_INPUT_EVENT_MOUSE_UP,
+	JS_RL_INPUT_EVENT_MOUSE_WHEEL,
+	JS_RL_INPUT_EVENT_GAMEPAD_DOWN,
+	JS_RL_INPUT_EVENT_GAMEPAD_UP,
+	JS_RL_INPUT_EVENT_GAMEPAD_AXIS,
+} JSRLInputEventType;
+
+// 24 bytes per event, see InputEventLayout in module/input.ts
+typedef struct JSRLInputEvent
+{
+	// Seconds, same clock as GetTime(). GLFW only runs its callbacks while
+	// EndDrawing polls for events, so this is when the event was polled, not
+	// when it happened: events of one frame get nearly the same time.
+	double time;
+	uint8_t type;
+	// Gamepad index of gamepad events
+	uint8_t device;
+	// GLFW modifier bits of key and mouse button events
+	uint16_t mods;
+	// Key, codepoint, button or axis
+	int32_t code;
+	// Mouse position, wheel offsets or axis value (x)
+	float x;
+	float y;
+} JSRLInputEvent;
+
+void js_rl_input_events_frame(void);
+void js_rl_input_events_close(void);
+
+JSValue js_rl_set_input_events(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_drain_input_events(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_input_event_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
+#pragma region Input recording
+
+// "QJRI" in a little-endian file
+#define JS_RL_INPUT_RECORDING_MAGIC 0x49524a51
+#define JS_RL_INPUT_RECORDING_VERSION 1
+
+// A recording is this header followed by one frame per endDrawing()
+typedef struct JSRLInputRecordingHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint32_t frame_size;
+	// Passed to srand(), which drives GetRandomValue()
+	uint32_t seed;
+} JSRLInputRecordingHeader;
+
+typedef struct JSRLInputFrame
+{
+	double time;
+	float frame_time;
+	JSRLInputState state;
+} JSRLInputFrame;
+
+// Called right after EndDrawing(), once raylib has polled the next frame's input
+void js_rl_input_recording_frame(void);
+void js_rl_input_recording_close(void);
+
+// Replay-aware versions of the raylib input and timing queries: while a
+// recording is replayed they answer from it, otherwise they call raylib
+bool js_rl_is_key_pressed(int key);
+bool js_rl_is_key_down(int key);
+bool js_rl_is_key_released(int key);
+bool js_rl_is_key_up(int key);
+int js_rl_get_key_pressed(void);
+bool js_rl_is_gamepad_available(int gamepad);
+bool js_rl_is_gamepad_button_pressed(int gamepad, int button);
+bool js_rl_is_gamepad_button_down(int gamepad, int button);
+bool js_rl_is_gamepad_button_released(int gamepad, int button);
+bool js_rl_is_gamepad_button_up(int gamepad, int button);
+int js_rl_get_gamepad_button_pressed(void);
+int js_rl_get_gamepad_axis_count(int gamepad);
+float js_rl_get_gamepad_axis_movement(int gamepad, int axis);
+bool js_rl_is_mouse_button_pressed(int button);
+bool js_rl_is_mouse_button_down(int button);
+bool js_rl_is_mouse_button_released(int button);
+bool js_rl_is_mouse_button_up(int button);
+int js_rl_get_mouse_x(void);
+int js_rl_get_mouse_y(void);
+Vector2 js_rl_get_mouse_position(void);
+int js_rl_get_mouse_wheel_move(void);
+int js_rl_get_touch_x(void);
+int js_rl_get_touch_y(void);
+Vector2 js_rl_get_touch_position(int index);
+bool js_rl_is_gesture_detected(int gesture);
+int js_rl_get_gesture_detected(void);
+int js_rl_get_touch_points_count(void);
+float js_rl_get_gesture_hold_duration(void);
+Vector2 js_rl_get_gesture_drag_vector(void);
+float js_rl_get_gesture_drag_angle(void);
+Vector2 js_rl_get_gesture_pinch_vector(void);
+float js_rl_get_gesture_pinch_angle(void);
+double js_rl_get_time(void);
+float js_rl_get_frame_time(void);
+// The clocks above jump between live and recorded time when this changes
+BOOL js_rl_is_replaying_input(void);
+
+JSValue js_rl_start_input_recording(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_stop_input_recording(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_start_input_replay(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_stop_input_replay(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_input_recording_state(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
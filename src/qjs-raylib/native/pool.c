@@ -0,0 +1,679 @@
+#include "pthread.h"
+#include "stdatomic.h"
+
+#include "pool.h"
+#include "strcache.h"
+
+#pragma region Pool
+
+typedef struct JSRLSlab
+{
+	struct JSRLSlab* next;
+} JSRLSlab;
+
+typedef struct JSRLPool
+{
+	size_t slot_size;
+	void* free_list;
+	JSRLSlab* slabs;
+	uint32_t slab_count;
+	uint32_t live;
+	uint32_t peak;
+	int64_t allocated;
+	int64_t freed;
+} JSRLPool;
+
+typedef struct JSRLArenaChunk
+{
+	struct JSRLArenaChunk* next;
+	size_t used;
+	uint32_t live;
+} JSRLArenaChunk;
+
+typedef struct JSRLFrameArena
+{
+	BOOL enabled;
+	BOOL in_frame;
+	JSRLArenaChunk* current;
+	// Chunks from previous frames that still hold live objects
+	JSRLArenaChunk* retired;
+	JSRLArenaChunk* spare;
+	uint32_t chunk_count;
+	int64_t frames;
+	int64_t allocated;
+	int64_t persisted;
+} JSRLFrameArena;
+
+typedef struct JSRLRuntimePools
+{
+	JSRuntime* rt;
+	JSRLPool pools[JS_RL_POOL_COUNT];
+	JSRLFrameArena arena;
+	// Contexts holding a runtime sentinel, see js_rl_init_runtime_sentinel()
+	uint32_t contexts;
+	// Set once the last context went away: the entry is freed as soon as the
+	// objects finalized after the sentinel have returned their memory
+	BOOL released;
+	struct JSRLRuntimePools* next;
+} JSRLRuntimePools;
+
+static const struct { const char* name; size_t size; } js_rl_pool_defs[JS_RL_POOL_COUNT] =
+{
+	[JS_RL_POOL_VECTOR2] = { "Vector2", sizeof(Vector2) },
+	[JS_RL_POOL_VECTOR3] = { "Vector3", sizeof(Vector3) },
+	[JS_RL_POOL_VECTOR4] = { "Vector4", sizeof(Vector4) },
+	[JS_RL_POOL_COLOR] = { "Color", sizeof(Color) },
+	[JS_RL_POOL_RECTANGLE] = { "Rectangle", sizeof(Rectangle) },
+	[JS_RL_POOL_MATRIX] = { "Matrix", sizeof(Matrix) },
+	[JS_RL_POOL_CAMERA2D] = { "Camera2D", sizeof(Camera2D) },
+	[JS_RL_POOL_CAMERA3D] = { "Camera3D", sizeof(Camera3D) },
+	[JS_RL_POOL_RAY] = { "Ray", sizeof(Ray) },
+};
+
+// Pools are looked up by runtime: the last hit is cached per thread since a
+// thread almost always talks to a single runtime. Freeing an entry bumps the
+// epoch, which invalidates what every thread cached before, so a cached
+// pointer is only followed while nothing was freed since it was looked up.
+static JSRLRuntimePools* js_rl_runtime_pools = NULL;
+static _Atomic uint64_t js_rl_runtime_pools_epoch = 0;
+static __thread JSRLRuntimePools* js_rl_runtime_pools_last = NULL;
+static __thread uint64_t js_rl_runtime_pools_last_epoch = 0;
+static pthread_mutex_t js_rl_runtime_pools_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static JSRLRuntimePools* js_rl_get_runtime_pools(JSRuntime* rt)
+{
+	JSRLRuntimePools* p = js_rl_runtime_pools_last;
+
+	if (p && js_rl_runtime_pools_last_epoch == atomic_load(&js_rl_runtime_pools_epoch) && p->rt == rt)
+		return p;
+
+	pthread_mutex_lock(&js_rl_runtime_pools_mutex);
+
+	uint64_t epoch = atomic_load(&js_rl_runtime_pools_epoch);
+
+	for (p = js_rl_runtime_pools; p; p = p->next)
+	{
+		if (p->rt == rt)
+			break;
+	}
+
+	if (!p)
+	{
+		p = calloc(1, sizeof(JSRLRuntimePools));
+
+		if (p)
+		{
+			p->rt = rt;
+
+			for (int i = 0; i < JS_RL_POOL_COUNT; i++)
+			{
+				size_t size = max_int(js_rl_pool_defs[i].size, sizeof(void*));
+				p->pools[i].slot_size = (size + 7) & ~(size_t)7;
+			}
+
+			p->next = js_rl_runtime_pools;
+			js_rl_runtime_pools = p;
+		}
+	}
+
+	pthread_mutex_unlock(&js_rl_runtime_pools_mutex);
+
+	js_rl_runtime_pools_last = p;
+	js_rl_runtime_pools_last_epoch = epoch;
+
+	return p;
+}
+
+static uint8_t* js_rl_slab_slots(JSRLSlab* slab)
+{
+	return (uint8_t*)(slab + 1);
+}
+
+static int js_rl_pool_grow(JSRLPool* pool)
+{
+	JSRLSlab* slab = malloc(sizeof(JSRLSlab) + pool->slot_size * JS_RL_POOL_SLAB_CAPACITY);
+
+	if (!slab)
+		return -1;
+
+	slab->next = pool->slabs;
+	pool->slabs = slab;
+	pool->slab_count++;
+
+	uint8_t* slots = js_rl_slab_slots(slab);
+
+	for (int i = JS_RL_POOL_SLAB_CAPACITY - 1; i >= 0; i--)
+	{
+		void** slot = (void**)(slots + i * pool->slot_size);
+		*slot = pool->free_list;
+		pool->free_list = slot;
+	}
+
+	return 0;
+}
+
+static void* js_rl_pool_alloc_slot(JSContext* ctx, JSRLPool* pool)
+{
+	if (!pool->free_list && js_rl_pool_grow(pool))
+	{
+		JS_ThrowOutOfMemory(ctx);
+		return NULL;
+	}
+
+	void* p = pool->free_list;
+	pool->free_list = *(void**)p;
+	memset(p, 0, pool->slot_size);
+
+	pool->allocated++;
+	pool->live++;
+
+	if (pool->live > pool->peak)
+		pool->peak = pool->live;
+
+	return p;
+}
+
+static void js_rl_pool_free_slot(JSRLPool* pool, void* p)
+{
+	*(void**)p = pool->free_list;
+	pool->free_list = p;
+
+	pool->freed++;
+	pool->live--;
+}
+
+static uint8_t* js_rl_chunk_data(JSRLArenaChunk* chunk)
+{
+	return (uint8_t*)(chunk + 1);
+}
+
+static BOOL js_rl_chunk_owns(JSRLArenaChunk* chunk, void* p)
+{
+	uint8_t* data = js_rl_chunk_data(chunk);
+	return (uint8_t*)p >= data && (uint8_t*)p < data + JS_RL_ARENA_CHUNK_SIZE;
+}
+
+static void* js_rl_arena_alloc(JSContext* ctx, JSRLFrameArena* arena, size_t size)
+{
+	JSRLArenaChunk* chunk = arena->current;
+
+	if (chunk && chunk->used + size > JS_RL_ARENA_CHUNK_SIZE && chunk->live == 0)
+		chunk->used = 0;
+
+	if (!chunk || chunk->used + size > JS_RL_ARENA_CHUNK_SIZE)
+	{
+		if (chunk)
+		{
+			chunk->next = arena->retired;
+			arena->retired = chunk;
+		}
+
+		chunk = arena->spare;
+
+		if (chunk)
+			arena->spare = chunk->next;
+		else
+		{
+			chunk = malloc(sizeof(JSRLArenaChunk) + JS_RL_ARENA_CHUNK_SIZE);
+
+			if (!chunk)
+			{
+				arena->current = NULL;
+				JS_ThrowOutOfMemory(ctx);
+				return NULL;
+			}
+
+			arena->chunk_count++;
+		}
+
+		chunk->next = NULL;
+		chunk->used = 0;
+		chunk->live = 0;
+		arena->current = chunk;
+	}
+
+	void* p = js_rl_chunk_data(chunk) + chunk->used;
+	chunk->used += size;
+	chunk->live++;
+	arena->allocated++;
+
+	memset(p, 0, size);
+
+	return p;
+}
+
+// Returns the arena chunk holding `p`, with `link` pointing at its slot in the
+// retired list, or NULL for the current chunk
+static JSRLArenaChunk* js_rl_arena_find(JSRLFrameArena* arena, void* p, JSRLArenaChunk*** link)
+{
+	if (arena->current && js_rl_chunk_owns(arena->current, p))
+	{
+		*link = NULL;
+		return arena->current;
+	}
+
+	for (JSRLArenaChunk** l = &arena->retired; *l; l = &(*l)->next)
+	{
+		if (js_rl_chunk_owns(*l, p))
+		{
+			*link = l;
+			return *l;
+		}
+	}
+
+	return NULL;
+}
+
+static void js_rl_arena_release(JSRLFrameArena* arena, JSRLArenaChunk* chunk, JSRLArenaChunk** link)
+{
+	chunk->live--;
+
+	// A retired chunk is reusable as soon as its last object is gone
+	if (link && chunk->live == 0)
+	{
+		*link = chunk->next;
+		chunk->next = arena->spare;
+		arena->spare = chunk;
+	}
+}
+
+// Frees the pools of a released runtime once none of their memory is in use
+static void js_rl_runtime_pools_collect(JSRLRuntimePools* pools)
+{
+	JSRLFrameArena* arena = &pools->arena;
+
+	if (arena->retired || (arena->current && arena->current->live))
+		return;
+
+	for (int i = 0; i < JS_RL_POOL_COUNT; i++)
+	{
+		if (pools->pools[i].live)
+			return;
+	}
+
+	pthread_mutex_lock(&js_rl_runtime_pools_mutex);
+
+	for (JSRLRuntimePools** link = &js_rl_runtime_pools; *link; link = &(*link)->next)
+	{
+		if (*link == pools)
+		{
+			*link = pools->next;
+			break;
+		}
+	}
+
+	atomic_fetch_add(&js_rl_runtime_pools_epoch, 1);
+	pthread_mutex_unlock(&js_rl_runtime_pools_mutex);
+
+	free(arena->current);
+
+	while (arena->spare)
+	{
+		JSRLArenaChunk* chunk = arena->spare;
+		arena->spare = chunk->next;
+		free(chunk);
+	}
+
+	for (int i = 0; i < JS_RL_POOL_COUNT; i++)
+	{
+		while (pools->pools[i].slabs)
+		{
+			JSRLSlab* slab = pools->pools[i].slabs;
+			pools->pools[i].slabs = slab->next;
+			free(slab);
+		}
+	}
+
+	free(pools);
+}
+
+void* js_rl_pool_alloc(JSContext* ctx, JSRLPoolKind kind)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(JS_GetRuntime(ctx));
+
+	if (!pools)
+	{
+		JS_ThrowOutOfMemory(ctx);
+		return NULL;
+	}
+
+	if (pools->arena.enabled && pools->arena.in_frame)
+		return js_rl_arena_alloc(ctx, &pools->arena, pools->pools[kind].slot_size);
+
+	return js_rl_pool_alloc_slot(ctx, &pools->pools[kind]);
+}
+
+void js_rl_pool_free(JSRuntime* rt, JSRLPoolKind kind, void* p)
+{
+	if (!p)
+		return;
+
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(rt);
+
+	if (!pools)
+		return;
+
+	JSRLArenaChunk** link;
+	JSRLArenaChunk* chunk = pools->arena.chunk_count ? js_rl_arena_find(&pools->arena, p, &link) : NULL;
+
+	if (chunk)
+		js_rl_arena_release(&pools->arena, chunk, link);
+	else
+		js_rl_pool_free_slot(&pools->pools[kind], p);
+
+	if (pools->released)
+		js_rl_runtime_pools_collect(pools);
+}
+
+void* js_rl_pool_persist(JSContext* ctx, JSRLPoolKind kind, void* p)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(JS_GetRuntime(ctx));
+
+	if (!pools || !pools->arena.chunk_count)
+		return p;
+
+	JSRLArenaChunk** link;
+	JSRLArenaChunk* chunk = js_rl_arena_find(&pools->arena, p, &link);
+
+	if (!chunk)
+		return p;
+
+	JSRLPool* pool = &pools->pools[kind];
+	void* copy = js_rl_pool_alloc_slot(ctx, pool);
+
+	if (!copy)
+		return NULL;
+
+	memcpy(copy, p, pool->slot_size);
+	js_rl_arena_release(&pools->arena, chunk, link);
+	pools->arena.persisted++;
+
+	return copy;
+}
+
+void js_rl_frame_begin(JSRuntime* rt)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(rt);
+
+	if (pools)
+		pools->arena.in_frame = TRUE;
+}
+
+void js_rl_frame_end(JSRuntime* rt)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(rt);
+
+	if (!pools)
+		return;
+
+	JSRLFrameArena* arena = &pools->arena;
+	JSRLArenaChunk* chunk = arena->current;
+
+	arena->in_frame = FALSE;
+
+	if (arena->enabled)
+		arena->frames++;
+
+	if (!chunk)
+		return;
+
+	// Rewind in place when the frame left nothing behind, otherwise the chunk
+	// stays retired until the values still pointing into it are collected
+	if (chunk->live == 0)
+		chunk->used = 0;
+	else
+	{
+		chunk->next = arena->retired;
+		arena->retired = chunk;
+		arena->current = NULL;
+	}
+}
+
+static int js_rl_compare_slabs(const void* a, const void* b)
+{
+	uintptr_t x = (uintptr_t)*(JSRLSlab* const*)a, y = (uintptr_t)*(JSRLSlab* const*)b;
+
+	return (x > y) - (x < y);
+}
+
+// Returns the index of the slab of `sorted` holding p
+static uint32_t js_rl_find_slab(JSRLSlab** sorted, uint32_t count, void* p)
+{
+	uint32_t lo = 0, hi = count;
+
+	// Last slab starting at or before p
+	while (hi - lo > 1)
+	{
+		uint32_t mid = (lo + hi) / 2;
+
+		if ((uint8_t*)sorted[mid] <= (uint8_t*)p)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+// Releases the slabs whose slots are all free. Slots are matched to their slab
+// by a binary search over the slabs sorted by address, then the free list is
+// rebuilt in a single pass without the slots of the released slabs.
+static void js_rl_pool_trim_slabs(JSRLPool* pool)
+{
+	if (pool->slab_count == 0)
+		return;
+
+	JSRLSlab** sorted = malloc(pool->slab_count * sizeof(JSRLSlab*));
+	uint32_t* free_counts = calloc(pool->slab_count, sizeof(uint32_t));
+
+	if (!sorted || !free_counts)
+	{
+		free(sorted);
+		free(free_counts);
+		return;
+	}
+
+	uint32_t count = 0;
+
+	for (JSRLSlab* slab = pool->slabs; slab; slab = slab->next)
+		sorted[count++] = slab;
+
+	qsort(sorted, count, sizeof(JSRLSlab*), js_rl_compare_slabs);
+
+	for (void* p = pool->free_list; p; p = *(void**)p)
+		free_counts[js_rl_find_slab(sorted, count, p)]++;
+
+	void** free_link = &pool->free_list;
+
+	for (void* p = pool->free_list; p; p = *(void**)p)
+	{
+		if (free_counts[js_rl_find_slab(sorted, count, p)] < JS_RL_POOL_SLAB_CAPACITY)
+		{
+			*free_link = p;
+			free_link = (void**)p;
+		}
+	}
+
+	*free_link = NULL;
+
+	JSRLSlab** link = &pool->slabs;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (free_counts[i] == JS_RL_POOL_SLAB_CAPACITY)
+		{
+			free(sorted[i]);
+			pool->slab_count--;
+		}
+		else
+		{
+			*link = sorted[i];
+			link = &sorted[i]->next;
+		}
+	}
+
+	*link = NULL;
+
+	free(sorted);
+	free(free_counts);
+}
+
+void js_rl_pool_trim(JSRuntime* rt)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(rt);
+
+	if (!pools)
+		return;
+
+	while (pools->arena.spare)
+	{
+		JSRLArenaChunk* chunk = pools->arena.spare;
+		pools->arena.spare = chunk->next;
+		pools->arena.chunk_count--;
+		free(chunk);
+	}
+
+	for (int i = 0; i < JS_RL_POOL_COUNT; i++)
+		js_rl_pool_trim_slabs(&pools->pools[i]);
+}
+
+JSValue js_rl_get_pool_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(JS_GetRuntime(ctx));
+
+	if (!pools)
+		return JS_ThrowOutOfMemory(ctx);
+
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	for (int i = 0; i < JS_RL_POOL_COUNT; i++)
+	{
+		JSRLPool* pool = &pools->pools[i];
+		JSValue stats = JS_NewObject(ctx);
+
+		JS_SetPropertyStr(ctx, stats, "live", JS_NewUint32(ctx, pool->live));
+		JS_SetPropertyStr(ctx, stats, "peak", JS_NewUint32(ctx, pool->peak));
+		JS_SetPropertyStr(ctx, stats, "allocated", JS_NewInt64(ctx, pool->allocated));
+		JS_SetPropertyStr(ctx, stats, "freed", JS_NewInt64(ctx, pool->freed));
+		JS_SetPropertyStr(ctx, stats, "slabs", JS_NewUint32(ctx, pool->slab_count));
+		JS_SetPropertyStr(ctx, stats, "bytes", JS_NewInt64(ctx, (int64_t)pool->slab_count * JS_RL_POOL_SLAB_CAPACITY * pool->slot_size));
+
+		JS_SetPropertyStr(ctx, obj, js_rl_pool_defs[i].name, stats);
+	}
+
+	return obj;
+}
+
+JSValue js_rl_trim_pools(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	js_rl_pool_trim(JS_GetRuntime(ctx));
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_set_frame_arena(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(JS_GetRuntime(ctx));
+
+	if (!pools)
+		return JS_ThrowOutOfMemory(ctx);
+
+	pools->arena.enabled = JS_ToBool(ctx, argv[0]);
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_get_frame_arena_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(JS_GetRuntime(ctx));
+
+	if (!pools)
+		return JS_ThrowOutOfMemory(ctx);
+
+	JSRLFrameArena* arena = &pools->arena;
+	uint32_t retired = 0, spare = 0;
+
+	for (JSRLArenaChunk* chunk = arena->retired; chunk; chunk = chunk->next)
+		retired++;
+
+	for (JSRLArenaChunk* chunk = arena->spare; chunk; chunk = chunk->next)
+		spare++;
+
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "enabled", JS_NewBool(ctx, arena->enabled));
+	JS_SetPropertyStr(ctx, obj, "frames", JS_NewInt64(ctx, arena->frames));
+	JS_SetPropertyStr(ctx, obj, "allocated", JS_NewInt64(ctx, arena->allocated));
+	JS_SetPropertyStr(ctx, obj, "persisted", JS_NewInt64(ctx, arena->persisted));
+	JS_SetPropertyStr(ctx, obj, "chunks", JS_NewUint32(ctx, arena->chunk_count));
+	JS_SetPropertyStr(ctx, obj, "retiredChunks", JS_NewUint32(ctx, retired));
+	JS_SetPropertyStr(ctx, obj, "spareChunks", JS_NewUint32(ctx, spare));
+	JS_SetPropertyStr(ctx, obj, "bytes", JS_NewInt64(ctx, (int64_t)arena->chunk_count * JS_RL_ARENA_CHUNK_SIZE));
+
+	return obj;
+}
+
+#pragma endregion
+#pragma region Runtime sentinel
+
+// Runtimes don't notify their teardown, so every context loading the module
+// keeps a sentinel in the module's import.meta, out of reach of scripts. The
+// last sentinel of a runtime to be finalized releases its pools and string
+// cache.
+static JSClassID js_rl_runtime_sentinel_class_id;
+
+static void js_rl_runtime_sentinel_finalizer(JSRuntime* rt, JSValue val)
+{
+	// The context is being freed but stays usable until its objects are
+	JSContext* ctx = JS_GetOpaque(val, js_rl_runtime_sentinel_class_id);
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(rt);
+
+	if (!ctx || !pools || --pools->contexts > 0)
+		return;
+
+	js_rl_string_cache_release(ctx);
+
+	pools->released = TRUE;
+	js_rl_pool_trim(rt);
+	js_rl_runtime_pools_collect(pools);
+}
+
+static JSClassDef js_rl_runtime_sentinel_class =
+{
+	"RuntimeSentinel",
+	.finalizer = js_rl_runtime_sentinel_finalizer,
+};
+
+void js_rl_init_runtime_sentinel(JSContext* ctx, JSModuleDef* m)
+{
+	JSRuntime* rt = JS_GetRuntime(ctx);
+	JSRLRuntimePools* pools = js_rl_get_runtime_pools(rt);
+
+	if (!pools)
+		return;
+
+	JS_NewClassID(&js_rl_runtime_sentinel_class_id);
+	JS_NewClass(rt, js_rl_runtime_sentinel_class_id, &js_rl_runtime_sentinel_class);
+
+	JSValue meta = JS_GetImportMeta(ctx, m);
+	JSValue sentinel = JS_NewObjectClass(ctx, js_rl_runtime_sentinel_class_id);
+
+	if (!JS_IsException(meta) && !JS_IsException(sentinel))
+	{
+		JS_SetOpaque(sentinel, ctx);
+		pools->contexts++;
+		pools->released = FALSE;
+		JS_DefinePropertyValueStr(ctx, meta, "runtimeSentinel", sentinel, 0);
+	}
+	else
+		JS_FreeValue(ctx, sentinel);
+
+	JS_FreeValue(ctx, meta);
+}
+
+#pragma endregion
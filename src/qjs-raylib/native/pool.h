@@ -0,0 +1,49 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+#include "raylib.h"
+
+#pragma region Pool
+
+// Number of payloads carved out of every slab
+#define JS_RL_POOL_SLAB_CAPACITY 256
+// Bytes bump-allocated from every frame arena chunk
+#define JS_RL_ARENA_CHUNK_SIZE 16384
+
+typedef enum JSRLPoolKind
+{
+	JS_RL_POOL_VECTOR2,
+	JS_RL_POOL_VECTOR3,
+	JS_RL_POOL_VECTOR4,
+	JS_RL_POOL_COLOR,
+	JS_RL_POOL_RECTANGLE,
+	JS_RL_POOL_MATRIX,
+	JS_RL_POOL_CAMERA2D,
+	JS_RL_POOL_CAMERA3D,
+	JS_RL_POOL_RAY,
+	JS_RL_POOL_COUNT,
+} JSRLPoolKind;
+
+void* js_rl_pool_alloc(JSContext* ctx, JSRLPoolKind kind);
+void js_rl_pool_free(JSRuntime* rt, JSRLPoolKind kind, void* p);
+void js_rl_pool_trim(JSRuntime* rt);
+void* js_rl_pool_persist(JSContext* ctx, JSRLPoolKind kind, void* p);
+
+void js_rl_frame_begin(JSRuntime* rt);
+void js_rl_frame_end(JSRuntime* rt);
+
+JSValue js_rl_get_pool_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_trim_pools(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_set_frame_arena(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_frame_arena_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
+#pragma region Runtime sentinel
+
+// Frees the pools and string cache of the runtime of ctx along with its last
+// context, called once per context from the module init
+void js_rl_init_runtime_sentinel(JSContext* ctx, JSModuleDef* m);
+
+#pragma endregion
@@ -0,0 +1,314 @@
+#include "stdlib.h"
+#include "math.h"
+
+#include "profiler.h"
+#include "structs.h"
+#include "trace.h"
+#include "args.h"
+
+#pragma region Frame profiler
+
+// Frames only exist once per window, so like the text layout cache the
+// profiler is shared by every runtime
+static struct
+{
+	BOOL enabled;
+	// Ring of capacity frames, JS_RL_PROFILE_FIELDS floats each
+	float* frames;
+	uint32_t capacity;
+	uint32_t count;
+	// Slot the next frame is written to
+	uint32_t next;
+	double frame_start;
+	double phase_start[JS_RL_PHASE_COUNT];
+	// Phases begun while the profiler was enabled. One open when it gets
+	// enabled has no start and is left out of that frame.
+	BOOL phase_open[JS_RL_PHASE_COUNT];
+	float current[JS_RL_PHASE_COUNT];
+	// Scratch space for percentiles
+	float* sorted;
+} js_rl_profiler;
+
+static const char* js_rl_phase_names[JS_RL_PHASE_COUNT] = { "update", "draw", "swap", "jobs", "gc" };
+
+// Trace timestamps of the open phases, 0 when the trace wasn't running as
+// the phase began. Kept apart from the profiler since the two are toggled
+// independently.
+static double js_rl_phase_trace_start[JS_RL_PHASE_COUNT];
+
+BOOL js_rl_profiler_enabled(void)
+{
+	return js_rl_profiler.enabled;
+}
+
+// Phases also show up as spans in traces. They are recorded as complete
+// events once they end, like bindings, since begin/end pairs would have to
+// nest with the binding spans they overlap.
+void js_rl_profile_begin(JSRLProfilePhase phase)
+{
+	js_rl_phase_trace_start[phase] = js_rl_tracing() ? js_rl_trace_now() : 0.0;
+
+	if (js_rl_profiler.enabled)
+	{
+		js_rl_profiler.phase_start[phase] = GetTime();
+		js_rl_profiler.phase_open[phase] = TRUE;
+	}
+}
+
+void js_rl_profile_end(JSRLProfilePhase phase)
+{
+	if (js_rl_profiler.enabled && js_rl_profiler.phase_open[phase])
+	{
+		js_rl_profiler.current[phase] += (float)((GetTime() - js_rl_profiler.phase_start[phase]) * 1000.0);
+		js_rl_profiler.phase_open[phase] = FALSE;
+	}
+
+	if (js_rl_phase_trace_start[phase] > 0.0 && js_rl_tracing())
+		js_rl_trace_complete(JS_RL_TRACE_FRAME, js_rl_phase_names[phase], js_rl_phase_trace_start[phase], js_rl_trace_now());
+
+	js_rl_phase_trace_start[phase] = 0.0;
+}
+
+void js_rl_profile_frame(void)
+{
+	js_rl_trace_instant(JS_RL_TRACE_FRAME, "frame");
+
+	if (!js_rl_profiler.enabled)
+		return;
+
+	double now = GetTime();
+	float* frame = &js_rl_profiler.frames[js_rl_profiler.next * JS_RL_PROFILE_FIELDS];
+	float total = (float)((now - js_rl_profiler.frame_start) * 1000.0);
+	float accounted = 0.0f;
+
+	for (int i = 0; i < JS_RL_PHASE_COUNT; i++)
+	{
+		frame[i] = js_rl_profiler.current[i];
+		accounted += js_rl_profiler.current[i];
+		js_rl_profiler.current[i] = 0.0f;
+	}
+
+	frame[JS_RL_PROFILE_TOTAL] = total;
+	frame[JS_RL_PROFILE_OTHER] = total > accounted ? total - accounted : 0.0f;
+
+	js_rl_profiler.next = (js_rl_profiler.next + 1) % js_rl_profiler.capacity;
+
+	if (js_rl_profiler.count < js_rl_profiler.capacity)
+		js_rl_profiler.count++;
+
+	js_rl_profiler.frame_start = now;
+}
+
+void js_rl_profiler_close(void)
+{
+	free(js_rl_profiler.frames);
+	free(js_rl_profiler.sorted);
+	memset(&js_rl_profiler, 0, sizeof(js_rl_profiler));
+}
+
+// Returns the i-th oldest frame of the ring
+static const float* js_rl_profiled_frame(uint32_t i)
+{
+	uint32_t slot = (js_rl_profiler.next + js_rl_profiler.capacity - js_rl_profiler.count + i) % js_rl_profiler.capacity;
+
+	return &js_rl_profiler.frames[slot * JS_RL_PROFILE_FIELDS];
+}
+
+static int js_rl_compare_floats(const void* a, const void* b)
+{
+	float x = *(const float*)a, y = *(const float*)b;
+
+	return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of the count sorted values
+static float js_rl_percentile(const float* sorted, uint32_t count, double p)
+{
+	double rank = ceil(p / 100.0 * count);
+
+	return sorted[rank < 1.0 ? 0 : (uint32_t)rank - 1];
+}
+
+typedef struct JSRLProfileStats
+{
+	float p50;
+	float p95;
+	float p99;
+	float max;
+	float mean;
+} JSRLProfileStats;
+
+static JSRLProfileStats js_rl_compute_profile_stats(void)
+{
+	JSRLProfileStats stats = { 0 };
+	uint32_t count = js_rl_profiler.count;
+
+	if (count == 0)
+		return stats;
+
+	double sum = 0.0;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		js_rl_profiler.sorted[i] = js_rl_profiled_frame(i)[JS_RL_PROFILE_TOTAL];
+		sum += js_rl_profiler.sorted[i];
+	}
+
+	qsort(js_rl_profiler.sorted, count, sizeof(float), js_rl_compare_floats);
+
+	stats.p50 = js_rl_percentile(js_rl_profiler.sorted, count, 50.0);
+	stats.p95 = js_rl_percentile(js_rl_profiler.sorted, count, 95.0);
+	stats.p99 = js_rl_percentile(js_rl_profiler.sorted, count, 99.0);
+	stats.max = js_rl_profiler.sorted[count - 1];
+	stats.mean = (float)(sum / count);
+
+	return stats;
+}
+
+JSValue js_rl_set_frame_profiler(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int enabled = JS_ToBool(ctx, argv[0]);
+	uint32_t capacity = JS_RL_PROFILER_DEFAULT_FRAMES;
+
+	if (enabled < 0)
+		return JS_EXCEPTION;
+
+	if (argc > 1 && !JS_IsUndefined(argv[1]) && JS_RL_TO_UINT32(ctx, &capacity, argv[1]))
+		return JS_EXCEPTION;
+
+	js_rl_profiler_close();
+
+	if (!enabled)
+		return JS_UNDEFINED;
+
+	if (capacity == 0)
+		return JS_ThrowRangeError(ctx, "the profiler needs at least one frame");
+
+	js_rl_profiler.frames = malloc((size_t)capacity * JS_RL_PROFILE_FIELDS * sizeof(float));
+	js_rl_profiler.sorted = malloc((size_t)capacity * sizeof(float));
+
+	if (!js_rl_profiler.frames || !js_rl_profiler.sorted)
+	{
+		js_rl_profiler_close();
+		return JS_ThrowOutOfMemory(ctx);
+	}
+
+	js_rl_profiler.enabled = TRUE;
+	js_rl_profiler.capacity = capacity;
+	js_rl_profiler.frame_start = GetTime();
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_get_frame_profile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t count = js_rl_profiler.count;
+	JSValue buffer = js_rl_new_array_buffer(ctx, (size_t)count * JS_RL_PROFILE_FIELDS * sizeof(float));
+
+	if (JS_IsException(buffer))
+		return buffer;
+
+	size_t size;
+	float* frames = (float*)JS_GetArrayBuffer(ctx, &size, buffer);
+
+	// Oldest frame first
+	for (uint32_t i = 0; i < count; i++)
+		memcpy(&frames[i * JS_RL_PROFILE_FIELDS], js_rl_profiled_frame(i), JS_RL_PROFILE_FIELDS * sizeof(float));
+
+	JSValue view = js_rl_new_typed_array(ctx, "Float32Array", buffer, 0, (size_t)count * JS_RL_PROFILE_FIELDS);
+	JS_FreeValue(ctx, buffer);
+
+	return view;
+}
+
+JSValue js_rl_get_frame_profile_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLProfileStats stats = js_rl_compute_profile_stats();
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "enabled", JS_NewBool(ctx, js_rl_profiler.enabled));
+	JS_SetPropertyStr(ctx, obj, "frames", JS_NewUint32(ctx, js_rl_profiler.count));
+	JS_SetPropertyStr(ctx, obj, "capacity", JS_NewUint32(ctx, js_rl_profiler.capacity));
+	JS_SetPropertyStr(ctx, obj, "p50", JS_NewFloat64(ctx, stats.p50));
+	JS_SetPropertyStr(ctx, obj, "p95", JS_NewFloat64(ctx, stats.p95));
+	JS_SetPropertyStr(ctx, obj, "p99", JS_NewFloat64(ctx, stats.p99));
+	JS_SetPropertyStr(ctx, obj, "max", JS_NewFloat64(ctx, stats.max));
+	JS_SetPropertyStr(ctx, obj, "mean", JS_NewFloat64(ctx, stats.mean));
+
+	return obj;
+}
+
+JSValue js_rl_draw_frame_profile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int x, y, width = 240, height = 80;
+	double budget = 1000.0 / 60.0;
+
+	if (JS_RL_TO_INT32(ctx, &x, argv[0]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_INT32(ctx, &y, argv[1]))
+		return JS_EXCEPTION;
+
+	if (argc > 2 && !JS_IsUndefined(argv[2]) && JS_RL_TO_INT32(ctx, &width, argv[2]))
+		return JS_EXCEPTION;
+
+	if (argc > 3 && !JS_IsUndefined(argv[3]) && JS_RL_TO_INT32(ctx, &height, argv[3]))
+		return JS_EXCEPTION;
+
+	if (argc > 4 && !JS_IsUndefined(argv[4]) && JS_RL_TO_FLOAT64(ctx, &budget, argv[4]))
+		return JS_EXCEPTION;
+
+	if (!js_rl_profiler.enabled || width <= 0 || height <= 0 || !(budget > 0.0))
+		return JS_UNDEFINED;
+
+	// Phases bottom to top, then the unaccounted time
+	static const Color colors[JS_RL_PHASE_COUNT + 1] =
+	{
+		{ 0, 158, 47, 255 },	// update: LIME
+		{ 0, 121, 241, 255 },	// draw: BLUE
+		{ 255, 161, 0, 255 },	// swap: ORANGE
+		{ 200, 122, 255, 255 },	// jobs: PURPLE
+		{ 230, 41, 55, 255 },	// gc: RED
+		{ 130, 130, 130, 255 },	// other: GRAY
+	};
+
+	// The graph spans twice the frame budget, the budget line sits halfway
+	float scale = (float)(height / (budget * 2.0));
+	float bar = (float)width / js_rl_profiler.capacity;
+
+	DrawRectangle(x, y, width, height, Fade(BLACK, 0.6f));
+
+	for (uint32_t i = 0; i < js_rl_profiler.count; i++)
+	{
+		const float* frame = js_rl_profiled_frame(i);
+		float bottom = (float)(y + height);
+		// Newest frame on the right
+		float left = x + width - (js_rl_profiler.count - i) * bar;
+
+		for (int phase = 0; phase <= JS_RL_PHASE_COUNT; phase++)
+		{
+			float ms = frame[phase == JS_RL_PHASE_COUNT ? JS_RL_PROFILE_OTHER : phase];
+			float h = fminf(ms * scale, bottom - y);
+
+			if (h <= 0.0f)
+				continue;
+
+			DrawRectangleRec((Rectangle){ left, bottom - h, fmaxf(bar, 1.0f), h }, colors[phase]);
+			bottom -= h;
+		}
+	}
+
+	DrawLine(x, y + height / 2, x + width, y + height / 2, Fade(WHITE, 0.5f));
+
+	JSRLProfileStats stats = js_rl_compute_profile_stats();
+	char text[96];
+	snprintf(text, sizeof(text), "p50 %.1f  p95 %.1f  p99 %.1f  max %.1f ms", stats.p50, stats.p95, stats.p99, stats.max);
+	DrawText(text, x + 4, y + 4, 10, RAYWHITE);
+
+	return JS_UNDEFINED;
+}
+
+#pragma endregion
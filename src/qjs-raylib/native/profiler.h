@@ -0,0 +1,49 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+#include "raylib.h"
+
+#pragma region Frame profiler
+
+#define JS_RL_PROFILER_DEFAULT_FRAMES 240
+
+// One float per field and frame, in milliseconds. Must stay in sync with
+// FrameProfileLayout in module/runtime.ts.
+typedef enum JSRLProfilePhase
+{
+	// Fixed-step updates of runMainLoop()
+	JS_RL_PHASE_UPDATE,
+	// beginDrawing() up to endDrawing(), JS draw code included
+	JS_RL_PHASE_DRAW,
+	// EndDrawing(): batch flush, buffer swap and the setTargetFps() wait
+	JS_RL_PHASE_SWAP,
+	// Promise jobs run by runMainLoop()
+	JS_RL_PHASE_JOBS,
+	// Garbage collections started by qjs-raylib
+	JS_RL_PHASE_GC,
+	JS_RL_PHASE_COUNT,
+} JSRLProfilePhase;
+
+// Fields of a profiled frame: the phases, then the frame total and the time
+// no phase accounts for (such as script code outside beginDrawing() and
+// endDrawing() in a hand-written loop)
+#define JS_RL_PROFILE_TOTAL JS_RL_PHASE_COUNT
+#define JS_RL_PROFILE_OTHER (JS_RL_PHASE_COUNT + 1)
+#define JS_RL_PROFILE_FIELDS (JS_RL_PHASE_COUNT + 2)
+
+BOOL js_rl_profiler_enabled(void);
+// Phases must not nest, each span is added to the current frame
+void js_rl_profile_begin(JSRLProfilePhase phase);
+void js_rl_profile_end(JSRLProfilePhase phase);
+// Closes the current frame, called at the end of endDrawing()
+void js_rl_profile_frame(void);
+void js_rl_profiler_close(void);
+
+JSValue js_rl_set_frame_profiler(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_frame_profile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_frame_profile_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_draw_frame_profile(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
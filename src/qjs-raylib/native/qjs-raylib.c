@@ -1,13 +1,22 @@
 #include "stdio.h"
 #include "string.h"
+#include "math.h"
 
 #include "quickjs/quickjs.h"
 #include "quickjs/cutils.h"
 #include "raylib.h"
+#include "GL/gl.h"
 
 #include "structs.h"
-
-#define JS_ATOM_length 48
+#include "drawlist.h"
+#include "strcache.h"
+#include "textcache.h"
+#include "input.h"
+#include "profiler.h"
+#include "trace.h"
+#include "bindings.h"
+#include "gc.h"
+#include "args.h"
 
 static JSValue JS_ThrowNotImplemented(JSContext* ctx)
 {
@@ -22,13 +31,13 @@ static JSValue rl_init_window(JSContext* ctx, JSValueConst this_val, int argc, J
 	int w, h;
 	const char* title = NULL;
 
-	if (JS_ToInt32(ctx, &w, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &w, argv[0]))
 		return JS_EXCEPTION;
 	
-	if (JS_ToInt32(ctx, &h, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &h, argv[1]))
 		return JS_EXCEPTION;
 
-	title = JS_ToCString(ctx, argv[2]);
+	title = js_rl_get_cached_string(ctx, argv[2]);
 	if (title == NULL)
 		return JS_EXCEPTION;
 
@@ -45,6 +54,12 @@ static JSValue rl_window_should_close(JSContext* ctx, JSValueConst this_val, int
 static JSValue rl_close_window(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	CloseWindow();
+	js_rl_input_events_close();
+	js_rl_input_recording_close();
+	js_rl_profiler_close();
+	js_rl_trace_close();
+	js_rl_string_cache_clear(ctx);
+	js_rl_clear_text_layouts();
 	return JS_UNDEFINED;
 }
 
@@ -88,10 +103,7 @@ static JSValue rl_hide_window(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_set_window_icon(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image *icon = (Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
-
-	if (!icon)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Image, icon, argv[0], js_rl_image_class_id);
 
 	SetWindowIcon(*icon);
 	return JS_UNDEFINED;
@@ -101,7 +113,7 @@ static JSValue rl_set_window_title(JSContext* ctx, JSValueConst this_val, int ar
 {
 	const char* title = NULL;
 
-	title = JS_ToCString(ctx, argv[0]);
+	title = js_rl_get_cached_string(ctx, argv[0]);
 	if (title == NULL)
 		return JS_EXCEPTION;
 
@@ -114,10 +126,10 @@ static JSValue rl_set_window_position(JSContext* ctx, JSValueConst this_val, int
 {
 	int x, y;
 
-	if (JS_ToInt32(ctx, &x, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 	
-	if (JS_ToInt32(ctx, &y, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &y, argv[1]))
 		return JS_EXCEPTION;
 
 	SetWindowPosition(x, y);
@@ -129,7 +141,7 @@ static JSValue rl_set_window_monitor(JSContext* ctx, JSValueConst this_val, int
 {
 	int m;
 
-	if (JS_ToInt32(ctx, &m, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &m, argv[0]))
 		return JS_EXCEPTION;
 
 	SetWindowMonitor(m);
@@ -141,10 +153,10 @@ static JSValue rl_set_window_min_size(JSContext* ctx, JSValueConst this_val, int
 {
 	int w, h;
 
-	if (JS_ToInt32(ctx, &w, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &w, argv[0]))
 		return JS_EXCEPTION;
 	
-	if (JS_ToInt32(ctx, &h, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &h, argv[1]))
 		return JS_EXCEPTION;
 
 	SetWindowMinSize(w, h);
@@ -156,10 +168,10 @@ static JSValue rl_set_window_size(JSContext* ctx, JSValueConst this_val, int arg
 {
 	int w, h;
 
-	if (JS_ToInt32(ctx, &w, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &w, argv[0]))
 		return JS_EXCEPTION;
 	
-	if (JS_ToInt32(ctx, &h, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &h, argv[1]))
 		return JS_EXCEPTION;
 
 	SetWindowSize(w, h);
@@ -186,7 +198,7 @@ static JSValue rl_get_monitor_width(JSContext* ctx, JSValueConst this_val, int a
 {
 	int m;
 
-	if (JS_ToInt32(ctx, &m, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &m, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, GetMonitorWidth(m));
@@ -196,7 +208,7 @@ static JSValue rl_get_monitor_height(JSContext* ctx, JSValueConst this_val, int
 {
 	int m;
 
-	if (JS_ToInt32(ctx, &m, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &m, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, GetMonitorHeight(m));
@@ -206,7 +218,7 @@ static JSValue rl_get_monitor_physical_width(JSContext* ctx, JSValueConst this_v
 {
 	int m;
 
-	if (JS_ToInt32(ctx, &m, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &m, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, GetMonitorPhysicalWidth(m));
@@ -216,7 +228,7 @@ static JSValue rl_get_monitor_physical_height(JSContext* ctx, JSValueConst this_
 {
 	int m;
 
-	if (JS_ToInt32(ctx, &m, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &m, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, GetMonitorPhysicalHeight(m));
@@ -226,7 +238,7 @@ static JSValue rl_get_monitor_name(JSContext* ctx, JSValueConst this_val, int ar
 {
 	int m;
 
-	if (JS_ToInt32(ctx, &m, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &m, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewString(ctx, GetMonitorName(m));
@@ -241,7 +253,7 @@ static JSValue rl_set_clipboard_text(JSContext* ctx, JSValueConst this_val, int
 {
 	const char* text = NULL;
 
-	text = JS_ToCString(ctx, argv[0]);
+	text = js_rl_get_cached_string(ctx, argv[0]);
 	if (text == NULL)
 		return JS_EXCEPTION;
 
@@ -292,7 +304,7 @@ static JSValue rl_clear_background(JSContext* ctx, JSValueConst this_val, int ar
 
 	if (JS_IsNumber(argv[0]))
 	{
-		if (JS_ToInt32(ctx, &colorInt, argv[0])) {
+		if (JS_RL_TO_INT32(ctx, &colorInt, argv[0])) {
 			ClearBackground(color);
 			return JS_UNDEFINED;
 		}
@@ -300,27 +312,52 @@ static JSValue rl_clear_background(JSContext* ctx, JSValueConst this_val, int ar
 			color = GetColor(colorInt);
 	}
 	else if (JS_IsObject(argv[0]))
-		color = *(Color*)JS_GetOpaque2(ctx, argv[0], js_rl_color_class_id);
+	{
+		JS_RL_ARG_VALUE(ctx, Color, value, argv[0], js_rl_color_class_id);
+		color = value;
+	}
 
 	ClearBackground(color);	
 	return JS_UNDEFINED;
 }
 
-static JSValue rl_begin_drawing(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+static void js_rl_begin_drawing(JSContext* ctx)
 {
+	js_rl_profile_begin(JS_RL_PHASE_DRAW);
 	BeginDrawing();
+	js_rl_frame_begin(JS_GetRuntime(ctx));
+}
+
+static void js_rl_end_drawing(JSContext* ctx)
+{
+	js_rl_profile_end(JS_RL_PHASE_DRAW);
+	js_rl_gc_idle(JS_GetRuntime(ctx));
+	js_rl_profile_begin(JS_RL_PHASE_SWAP);
+	EndDrawing();
+	js_rl_profile_end(JS_RL_PHASE_SWAP);
+	js_rl_gc_frame_start();
+	js_rl_frame_end(JS_GetRuntime(ctx));
+	js_rl_string_cache_sweep(ctx);
+	js_rl_input_recording_frame();
+	js_rl_input_events_frame();
+	js_rl_profile_frame();
+}
+
+static JSValue rl_begin_drawing(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	js_rl_begin_drawing(ctx);
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_end_drawing(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	EndDrawing();
+	js_rl_end_drawing(ctx);
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_begin_mode_2d(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Camera2D cam = *(Camera2D*)JS_GetOpaque2(ctx, argv[0], js_rl_camera2d_class_id);
+	JS_RL_ARG_VALUE(ctx, Camera2D, cam, argv[0], js_rl_camera2d_class_id);
 	BeginMode2D(cam);
 	return JS_UNDEFINED;
 }
@@ -333,7 +370,7 @@ static JSValue rl_end_mode_2d(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_begin_mode_3d(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Camera3D cam = *(Camera3D*)JS_GetOpaque2(ctx, argv[0], js_rl_camera3d_class_id);
+	JS_RL_ARG_VALUE(ctx, Camera3D, cam, argv[0], js_rl_camera3d_class_id);
 	BeginMode3D(cam);
 	return JS_UNDEFINED;
 }
@@ -346,7 +383,7 @@ static JSValue rl_end_mode_3d(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_begin_texture_mode(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	RenderTexture2D tex = *(RenderTexture2D*)JS_GetOpaque2(ctx, argv[0], js_rl_render_texture_class_id);
+	JS_RL_ARG_VALUE(ctx, RenderTexture2D, tex, argv[0], js_rl_render_texture_class_id);
 	BeginTextureMode(tex);
 	return JS_UNDEFINED;
 }
@@ -362,61 +399,31 @@ static JSValue rl_end_texture_mode(JSContext* ctx, JSValueConst this_val, int ar
 
 static JSValue rl_get_mouse_ray(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_ray_class_id);
-	Vector2 mousePosition = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Camera camera = *(Camera*)JS_GetOpaque2(ctx, argv[1], js_rl_camera3d_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, mousePosition, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Camera, camera, argv[1], js_rl_camera3d_class_id);
 
-	Ray* p = js_mallocz(ctx, sizeof(Ray));
 	Ray ray = GetMouseRay(mousePosition, camera);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	memcpy(p, &ray, sizeof(Ray));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_RAY, &ray, argc, argv, 2);
 }
 
 static JSValue rl_get_world_to_screen(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_ray_class_id);
-	Vector3 spacePos = *(Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-	Camera camera = *(Camera3D*)JS_GetOpaque2(ctx, argv[1], js_rl_camera3d_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector3, spacePos, argv[0], js_rl_vector3_class_id);
+	JS_RL_ARG_VALUE(ctx, Camera, camera, argv[1], js_rl_camera3d_class_id);
 
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
 	Vector2 screenPos = GetWorldToScreen(spacePos, camera);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	memcpy(p, &screenPos, sizeof(Vector2));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR2, &screenPos, argc, argv, 2);
 }
 
 static JSValue rl_get_camera_matrix(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_matrix_class_id);
-	Camera camera = *(Camera3D*)JS_GetOpaque2(ctx, argv[0], js_rl_camera3d_class_id);
-
-	Matrix* p = js_mallocz(ctx, sizeof(Matrix));
-	Matrix matrix = GetCameraMatrix(camera);
+	JS_RL_ARG_VALUE(ctx, Camera, camera, argv[0], js_rl_camera3d_class_id);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
+	Matrix m = GetCameraMatrix(camera);
 
-	memcpy(p, &matrix, sizeof(Matrix));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_MATRIX, &m, argc, argv, 1);
 }
 
 #pragma endregion
@@ -426,10 +433,11 @@ static JSValue rl_set_target_fps(JSContext* ctx, JSValueConst this_val, int argc
 {
 	int fps;
 
-	if (JS_ToInt32(ctx, &fps, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &fps, argv[0]))
 		return JS_EXCEPTION;
 
 	SetTargetFPS(fps);
+	js_rl_gc_set_target_fps(fps);
 
 	return JS_UNDEFINED;
 }
@@ -441,126 +449,285 @@ static JSValue rl_get_fps(JSContext* ctx, JSValueConst this_val, int argc, JSVal
 
 static JSValue rl_get_frame_time(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewFloat64(ctx, GetFrameTime());
+	return JS_NewFloat64(ctx, js_rl_get_frame_time());
 }
 
 static JSValue rl_get_time(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewFloat64(ctx, GetTime());
+	return JS_NewFloat64(ctx, js_rl_get_time());
 }
 
 #pragma endregion
-#pragma region Color-related functions
+#pragma region Main loop functions
 
-static JSValue rl_color_to_int(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+// Defaults of the runMainLoop() options
+#define JS_RL_MAIN_LOOP_FIXED_DT (1.0 / 60.0)
+#define JS_RL_MAIN_LOOP_MAX_STEPS 5
+#define JS_RL_MAIN_LOOP_JOB_BUDGET 0.002
+#define JS_RL_MAIN_LOOP_MAX_FRAME_TIME 0.25
+
+static BOOL js_rl_main_loop_stop;
+
+static int js_rl_get_option_float64(JSContext* ctx, JSValueConst options, const char* name, double* value)
 {
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[0], js_rl_color_class_id);
-	return JS_NewInt32(ctx, ColorToInt(color));
+	JSValue v = JS_GetPropertyStr(ctx, options, name);
+	int ret = 0;
+
+	if (JS_IsException(v))
+		return -1;
+
+	if (!JS_IsUndefined(v))
+		ret = JS_RL_TO_FLOAT64(ctx, value, v);
+
+	JS_FreeValue(ctx, v);
+
+	return ret;
 }
 
-static JSValue rl_color_normalize(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+// Calls fn (when it is a function) with a single number, FALSE means fn threw
+static BOOL js_rl_call_with_number(JSContext* ctx, JSValueConst fn, double n)
 {
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[0], js_rl_color_class_id);
+	if (!JS_IsFunction(ctx, fn))
+		return TRUE;
 
-	Vector4* p = js_mallocz(ctx, sizeof(Vector4));
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector3_class_id);
+	JSValue arg = JS_NewFloat64(ctx, n);
+	JSValue ret = JS_Call(ctx, fn, JS_UNDEFINED, 1, &arg);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
+	if (JS_IsException(ret))
+		return FALSE;
 
-	Vector4 vector4 = ColorNormalize(color);
-	memcpy(p, &vector4, sizeof(Vector4));
-	JS_SetOpaque(obj, p);
+	JS_FreeValue(ctx, ret);
 
-	return obj;
+	return TRUE;
 }
 
-static JSValue rl_color_to_hsv(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+// Runs pending promise jobs until none is left or the budget is spent, at
+// least one job runs per frame so a small budget can't starve the queue
+static BOOL js_rl_run_pending_jobs(JSContext* ctx, double budget)
 {
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[0], js_rl_color_class_id);
-	Vector3* p = js_mallocz(ctx, sizeof(Vector3));
-	Vector3 hsv = ColorToHSV(color);
+	JSRuntime* rt = JS_GetRuntime(ctx);
+	double deadline = GetTime() + budget;
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector3_class_id);
+	do
+	{
+		JSContext* job_ctx;
+		int ret = JS_ExecutePendingJob(rt, &job_ctx);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
+		if (ret == 0)
+			break;
 
-	memcpy(p, &hsv, sizeof(Vector3));
-	JS_SetOpaque(obj, p);
+		if (ret < 0)
+		{
+			// Report the failure in the context that called runMainLoop()
+			JS_Throw(ctx, JS_GetException(job_ctx));
+			return FALSE;
+		}
+	}
+	while (GetTime() < deadline);
 
-	return obj;
+	return TRUE;
 }
 
-static JSValue rl_color_from_hsv(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+static JSValue rl_run_main_loop(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3 hsv = *(Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
+	JSValueConst options = argv[0];
+	double fixed_dt = JS_RL_MAIN_LOOP_FIXED_DT;
+	double max_steps = JS_RL_MAIN_LOOP_MAX_STEPS;
+	double job_budget = JS_RL_MAIN_LOOP_JOB_BUDGET;
+	double frame_budget = 0.0;
+	double max_frame_time = JS_RL_MAIN_LOOP_MAX_FRAME_TIME;
 
-	Color* p = js_mallocz(ctx, sizeof(Color));
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_color_class_id);
+	if (!JS_IsObject(options))
+		return JS_ThrowTypeError(ctx, "runMainLoop expects an options object");
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	if (js_rl_get_option_float64(ctx, options, "fixedDt", &fixed_dt) ||
+		js_rl_get_option_float64(ctx, options, "maxSteps", &max_steps) ||
+		js_rl_get_option_float64(ctx, options, "jobBudget", &job_budget) ||
+		js_rl_get_option_float64(ctx, options, "frameBudget", &frame_budget) ||
+		js_rl_get_option_float64(ctx, options, "maxFrameTime", &max_frame_time))
 		return JS_EXCEPTION;
+
+	if (!(fixed_dt > 0.0) || !(max_steps >= 1.0) || !(max_frame_time > 0.0))
+		return JS_ThrowRangeError(ctx, "fixedDt and maxFrameTime must be positive and maxSteps at least 1");
+
+	JSValue update = JS_GetPropertyStr(ctx, options, "update");
+	JSValue draw = JS_GetPropertyStr(ctx, options, "draw");
+	JSValue on_late_frame = JS_GetPropertyStr(ctx, options, "onLateFrame");
+	BOOL ok = !JS_IsException(update) && !JS_IsException(draw) && !JS_IsException(on_late_frame);
+
+	int64_t frames = 0, updates = 0, late_frames = 0;
+	double dropped_time = 0.0;
+	double accumulator = 0.0;
+	// Replay-aware clock so a replayed session takes the same steps
+	double previous = js_rl_get_time();
+	BOOL replaying = js_rl_is_replaying_input();
+
+	js_rl_main_loop_stop = FALSE;
+
+	while (ok && !js_rl_main_loop_stop && !WindowShouldClose())
+	{
+		double now = js_rl_get_time();
+		double elapsed = now - previous;
+		int steps = 0;
+
+		// Starting or ending a replay switches between recorded and live time:
+		// resync instead of stepping by the jump. The clamp also keeps a clock
+		// going backwards from freezing update() until it catches up.
+		if (replaying != js_rl_is_replaying_input())
+		{
+			replaying = !replaying;
+			elapsed = 0.0;
+		}
+
+		elapsed = fmin(fmax(elapsed, 0.0), max_frame_time);
+
+		previous = now;
+		accumulator += elapsed;
+
+		js_rl_profile_begin(JS_RL_PHASE_UPDATE);
+
+		while (ok && accumulator >= fixed_dt && steps < max_steps)
+		{
+			ok = js_rl_call_with_number(ctx, update, fixed_dt);
+			accumulator -= fixed_dt;
+			steps++;
+			updates++;
+		}
+
+		js_rl_profile_end(JS_RL_PHASE_UPDATE);
+
+		if (!ok)
+			break;
+
+		// Too far behind to catch up: drop the backlog instead of spiralling
+		double dropped = 0.0;
+
+		if (accumulator >= fixed_dt)
+		{
+			dropped = accumulator - fmod(accumulator, fixed_dt);
+			accumulator -= dropped;
+			dropped_time += dropped;
+		}
+
+		if (dropped > 0.0 || (frame_budget > 0.0 && elapsed > frame_budget))
+		{
+			late_frames++;
+
+			if (JS_IsFunction(ctx, on_late_frame))
+			{
+				JSValue args[2] = { JS_NewFloat64(ctx, elapsed), JS_NewFloat64(ctx, dropped) };
+				JSValue ret = JS_Call(ctx, on_late_frame, JS_UNDEFINED, 2, args);
+
+				if (JS_IsException(ret))
+				{
+					ok = FALSE;
+					break;
+				}
+
+				JS_FreeValue(ctx, ret);
+			}
+		}
+
+		// The frame is always ended so raylib's batch stays consistent when draw throws
+		js_rl_begin_drawing(ctx);
+		ok = js_rl_call_with_number(ctx, draw, accumulator / fixed_dt);
+		js_rl_end_drawing(ctx);
+		frames++;
+
+		if (ok)
+		{
+			js_rl_profile_begin(JS_RL_PHASE_JOBS);
+			ok = js_rl_run_pending_jobs(ctx, job_budget);
+			js_rl_profile_end(JS_RL_PHASE_JOBS);
+		}
 	}
 
-	Color color = ColorFromHSV(hsv);
-	memcpy(p, &color, sizeof(Color));
+	JS_FreeValue(ctx, update);
+	JS_FreeValue(ctx, draw);
+	JS_FreeValue(ctx, on_late_frame);
 
-	JS_SetOpaque(obj, p);
+	if (!ok)
+		return JS_EXCEPTION;
+
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "frames", JS_NewInt64(ctx, frames));
+	JS_SetPropertyStr(ctx, obj, "updates", JS_NewInt64(ctx, updates));
+	JS_SetPropertyStr(ctx, obj, "lateFrames", JS_NewInt64(ctx, late_frames));
+	JS_SetPropertyStr(ctx, obj, "droppedTime", JS_NewFloat64(ctx, dropped_time));
 
 	return obj;
 }
 
-static JSValue rl_get_color(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+static JSValue rl_stop_main_loop(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	int colorInt;
+	js_rl_main_loop_stop = TRUE;
+	return JS_UNDEFINED;
+}
 
-	if (JS_ToInt32(ctx, &colorInt, argv[0]))
-		return JS_UNDEFINED;
+#pragma endregion
+#pragma region Color-related functions
+
+static JSValue rl_color_to_int(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[0], js_rl_color_class_id);
+	return JS_NewInt32(ctx, ColorToInt(color));
+}
 
-	Color* p = js_mallocz(ctx, sizeof(Color));
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_color_class_id);
+static JSValue rl_color_normalize(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[0], js_rl_color_class_id);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
+	Vector4 vector4 = ColorNormalize(color);
 
-	Color color = GetColor(colorInt);
-	memcpy(p, &color, sizeof(Color));
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR4, &vector4, argc, argv, 1);
+}
 
-	JS_SetOpaque(obj, p);
+static JSValue rl_color_to_hsv(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[0], js_rl_color_class_id);
 
-	return obj;
+	Vector3 hsv = ColorToHSV(color);
+
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR3, &hsv, argc, argv, 1);
 }
 
-static JSValue rl_fade(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+static JSValue rl_color_from_hsv(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[0], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector3, hsv, argv[0], js_rl_vector3_class_id);
 
-	Color* p = js_mallocz(ctx, sizeof(Color));
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_color_class_id);
+	Color color = ColorFromHSV(hsv);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
+	return js_rl_return_struct(ctx, JS_RL_POOL_COLOR, &color, argc, argv, 1);
+}
+
+static JSValue rl_get_color(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int colorInt;
+
+	if (JS_RL_TO_INT32(ctx, &colorInt, argv[0]))
+		return JS_UNDEFINED;
+
+	Color color = GetColor(colorInt);
+
+	return js_rl_return_struct(ctx, JS_RL_POOL_COLOR, &color, argc, argv, 1);
+}
+
+static JSValue rl_fade(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[0], js_rl_color_class_id);
 
 	double fade;
 
-	if (JS_ToFloat64(ctx, &fade, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &fade, argv[1]))
 		return JS_EXCEPTION;
 
 	Color newColor = Fade(color, fade);
-	memcpy(p, &newColor, sizeof(Color));
-	JS_SetOpaque(obj, p);
 
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_COLOR, &newColor, argc, argv, 2);
 }
 
 #pragma endregion
@@ -570,7 +737,7 @@ static JSValue rl_set_config_flags(JSContext* ctx, JSValueConst this_val, int ar
 {
 	int flags;
 
-	if (JS_ToInt32(ctx, &flags, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &flags, argv[0]))
 		return JS_EXCEPTION;
 
 	SetConfigFlags((unsigned char)flags);
@@ -582,7 +749,7 @@ static JSValue rl_set_trace_log_level(JSContext* ctx, JSValueConst this_val, int
 {
 	int logType;
 
-	if (JS_ToInt32(ctx, &logType, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &logType, argv[0]))
 		return JS_EXCEPTION;
 
 	SetTraceLogLevel(logType);
@@ -594,7 +761,7 @@ static JSValue rl_set_trace_log_exit(JSContext* ctx, JSValueConst this_val, int
 {
 	int logType;
 
-	if (JS_ToInt32(ctx, &logType, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &logType, argv[0]))
 		return JS_EXCEPTION;
 
 	SetTraceLogExit(logType);
@@ -604,7 +771,7 @@ static JSValue rl_set_trace_log_exit(JSContext* ctx, JSValueConst this_val, int
 
 static JSValue rl_take_screenshot(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = JS_ToCString(ctx, argv[0]);
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -617,10 +784,10 @@ static JSValue rl_get_random_value(JSContext* ctx, JSValueConst this_val, int ar
 {
 	int min, max;
 
-	if (JS_ToInt32(ctx, &min, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &min, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &max, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &max, argv[1]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, GetRandomValue(min, max));
@@ -628,7 +795,7 @@ static JSValue rl_get_random_value(JSContext* ctx, JSValueConst this_val, int ar
 
 static JSValue rl_open_url(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* url = JS_ToCString(ctx, argv[0]);
+	const char* url = js_rl_get_cached_string(ctx, argv[0]);
 	if (url == NULL)
 		return JS_EXCEPTION;
 
@@ -642,7 +809,7 @@ static JSValue rl_open_url(JSContext* ctx, JSValueConst this_val, int argc, JSVa
 
 static JSValue rl_file_exists(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = JS_ToCString(ctx, argv[0]);
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -651,20 +818,30 @@ static JSValue rl_file_exists(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_is_file_extension(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
+	// Converting the second string may run a toString that evicts the
+	// first from the string cache, so both are converted here
 	const char* fileName = JS_ToCString(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
-	const char* extension = JS_ToCString(ctx, argv[2]);
+	const char* extension = JS_ToCString(ctx, argv[1]);
 	if (extension == NULL)
+	{
+		JS_FreeCString(ctx, fileName);
 		return JS_EXCEPTION;
+	}
 
-	return JS_NewBool(ctx, IsFileExtension(fileName, extension));
+	BOOL result = IsFileExtension(fileName, extension);
+
+	JS_FreeCString(ctx, fileName);
+	JS_FreeCString(ctx, extension);
+
+	return JS_NewBool(ctx, result);
 }
 
 static JSValue rl_get_extension(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = JS_ToCString(ctx, argv[0]);
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -673,7 +850,7 @@ static JSValue rl_get_extension(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_get_file_name(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* filePath = JS_ToCString(ctx, argv[0]);
+	const char* filePath = js_rl_get_cached_string(ctx, argv[0]);
 	if (filePath == NULL)
 		return JS_EXCEPTION;
 
@@ -682,7 +859,7 @@ static JSValue rl_get_file_name(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_get_file_name_without_extension(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* filePath = JS_ToCString(ctx, argv[0]);
+	const char* filePath = js_rl_get_cached_string(ctx, argv[0]);
 	if (filePath == NULL)
 		return JS_EXCEPTION;
 
@@ -691,7 +868,7 @@ static JSValue rl_get_file_name_without_extension(JSContext* ctx, JSValueConst t
 
 static JSValue rl_get_directory_path(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = JS_ToCString(ctx, argv[0]);
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -705,7 +882,7 @@ static JSValue rl_get_working_directory(JSContext* ctx, JSValueConst this_val, i
 
 static JSValue rl_get_directory_files(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* dirPath = JS_ToCString(ctx, argv[0]);
+	const char* dirPath = js_rl_get_cached_string(ctx, argv[0]);
 	if (dirPath == NULL)
 		return JS_EXCEPTION;
 
@@ -724,7 +901,7 @@ static JSValue rl_get_directory_files(JSContext* ctx, JSValueConst this_val, int
 
 static JSValue rl_change_directory(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* dir = JS_ToCString(ctx, argv[0]);
+	const char* dir = js_rl_get_cached_string(ctx, argv[0]);
 	if (dir == NULL)
 		return JS_EXCEPTION;
 
@@ -753,7 +930,7 @@ static JSValue rl_get_dropped_files(JSContext* ctx, JSValueConst this_val, int a
 
 static JSValue rl_get_file_mod_time(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = JS_ToCString(ctx, argv[0]);
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -767,10 +944,10 @@ static JSValue rl_storage_save_value(JSContext* ctx, JSValueConst this_val, int
 {
 	int position, value;
 
-	if (JS_ToInt32(ctx, &position, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &position, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &value, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &value, argv[1]))
 		return JS_EXCEPTION;
 
 	SaveStorageValue(position, value);
@@ -782,7 +959,7 @@ static JSValue rl_storage_load_value(JSContext* ctx, JSValueConst this_val, int
 {
 	int position;
 
-	if (JS_ToInt32(ctx, &position, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &position, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, LoadStorageValue(position));
@@ -795,52 +972,52 @@ static JSValue rl_is_key_pressed(JSContext* ctx, JSValueConst this_val, int argc
 {
 	int key;
 
-	if (JS_ToInt32(ctx, &key, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &key, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsKeyPressed(key));
+	return JS_NewBool(ctx, js_rl_is_key_pressed(key));
 }
 
 static JSValue rl_is_key_down(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int key;
 
-	if (JS_ToInt32(ctx, &key, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &key, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsKeyDown(key));
+	return JS_NewBool(ctx, js_rl_is_key_down(key));
 }
 
 static JSValue rl_is_key_released(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int key;
 
-	if (JS_ToInt32(ctx, &key, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &key, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsKeyReleased(key));
+	return JS_NewBool(ctx, js_rl_is_key_released(key));
 }
 
 static JSValue rl_is_key_up(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int key;
 
-	if (JS_ToInt32(ctx, &key, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &key, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsKeyUp(key));
+	return JS_NewBool(ctx, js_rl_is_key_up(key));
 }
 
 static JSValue rl_get_key_pressed(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetKeyPressed());
+	return JS_NewInt32(ctx, js_rl_get_key_pressed());
 }
 
 static JSValue rl_set_exit_key(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int key;
 
-	if (JS_ToInt32(ctx, &key, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &key, argv[0]))
 		return JS_EXCEPTION;
 
 	SetExitKey(key);
@@ -855,20 +1032,20 @@ static JSValue rl_is_gamepad_available(JSContext* ctx, JSValueConst this_val, in
 {
 	int gamepad;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsGamepadAvailable(gamepad));
+	return JS_NewBool(ctx, js_rl_is_gamepad_available(gamepad));
 }
 
 static JSValue rl_is_gamepad_name(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int gamepad;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	const char* name = JS_ToCString(ctx, argv[1]);
+	const char* name = js_rl_get_cached_string(ctx, argv[1]);
 	if (name == NULL)
 		return JS_EXCEPTION;
 
@@ -879,7 +1056,7 @@ static JSValue rl_get_gamepad_name(JSContext* ctx, JSValueConst this_val, int ar
 {
 	int gamepad;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
 	return JS_NewString(ctx, GetGamepadName(gamepad));
@@ -889,80 +1066,80 @@ static JSValue rl_is_gamepad_button_pressed(JSContext* ctx, JSValueConst this_va
 {
 	int gamepad, button;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &button, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[1]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsGamepadButtonPressed(gamepad, button));
+	return JS_NewBool(ctx, js_rl_is_gamepad_button_pressed(gamepad, button));
 }
 
 static JSValue rl_is_gamepad_button_down(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int gamepad, button;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &button, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[1]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsGamepadButtonDown(gamepad, button));
+	return JS_NewBool(ctx, js_rl_is_gamepad_button_down(gamepad, button));
 }
 
 static JSValue rl_is_gamepad_button_released(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int gamepad, button;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &button, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[1]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsGamepadButtonReleased(gamepad, button));
+	return JS_NewBool(ctx, js_rl_is_gamepad_button_released(gamepad, button));
 }
 
 static JSValue rl_is_gamepad_button_up(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int gamepad, button;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &button, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[1]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsGamepadButtonUp(gamepad, button));
+	return JS_NewBool(ctx, js_rl_is_gamepad_button_up(gamepad, button));
 }
 
 static JSValue rl_get_gamepad_button_pressed(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetGamepadButtonPressed());
+	return JS_NewInt32(ctx, js_rl_get_gamepad_button_pressed());
 }
 
 static JSValue rl_get_gamepad_axis_count(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int gamepad;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, GetGamepadAxisCount(gamepad));
+	return JS_NewInt32(ctx, js_rl_get_gamepad_axis_count(gamepad));
 }
 
 static JSValue rl_get_gamepad_axis_movement(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int gamepad, axis;
 
-	if (JS_ToInt32(ctx, &gamepad, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gamepad, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &axis, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &axis, argv[1]))
 		return JS_EXCEPTION;
 
-	return JS_NewFloat64(ctx, GetGamepadAxisMovement(gamepad, axis));
+	return JS_NewFloat64(ctx, js_rl_get_gamepad_axis_movement(gamepad, axis));
 }
 
 #pragma endregion
@@ -972,78 +1149,67 @@ static JSValue rl_is_mouse_button_pressed(JSContext* ctx, JSValueConst this_val,
 {
 	int button;
 
-	if (JS_ToInt32(ctx, &button, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsMouseButtonPressed(button));
+	return JS_NewBool(ctx, js_rl_is_mouse_button_pressed(button));
 }
 
 static JSValue rl_is_mouse_button_down(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int button;
 
-	if (JS_ToInt32(ctx, &button, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsMouseButtonDown(button));
+	return JS_NewBool(ctx, js_rl_is_mouse_button_down(button));
 }
 
 static JSValue rl_is_mouse_button_released(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int button;
 
-	if (JS_ToInt32(ctx, &button, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsMouseButtonReleased(button));
+	return JS_NewBool(ctx, js_rl_is_mouse_button_released(button));
 }
 
 static JSValue rl_is_mouse_button_up(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int button;
 
-	if (JS_ToInt32(ctx, &button, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &button, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsMouseButtonUp(button));
+	return JS_NewBool(ctx, js_rl_is_mouse_button_up(button));
 }
 
 static JSValue rl_get_mouse_x(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetMouseX());
+	return JS_NewInt32(ctx, js_rl_get_mouse_x());
 }
 
 static JSValue rl_get_mouse_y(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetMouseY());
+	return JS_NewInt32(ctx, js_rl_get_mouse_y());
 }
 
 static JSValue rl_get_mouse_position(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
-	Vector2 mousePos = GetMousePosition();
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	memcpy(p, &mousePos, sizeof(Vector2));
-	JS_SetOpaque(obj, p);
+	Vector2 mousePos = js_rl_get_mouse_position();
 
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR2, &mousePos, argc, argv, 0);
 }
 
 static JSValue rl_set_mouse_position(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int x, y;
 
-	if (JS_ToInt32(ctx, &x, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &y, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &y, argv[1]))
 		return JS_EXCEPTION;
 
 	SetMousePosition(x, y);
@@ -1055,10 +1221,10 @@ static JSValue rl_set_mouse_offset(JSContext* ctx, JSValueConst this_val, int ar
 {
 	int x, y;
 
-	if (JS_ToInt32(ctx, &x, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &y, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &y, argv[1]))
 		return JS_EXCEPTION;
 
 	SetMouseOffset(x, y);
@@ -1070,10 +1236,10 @@ static JSValue rl_set_mouse_scale(JSContext* ctx, JSValueConst this_val, int arg
 {
 	double x, y;
 
-	if (JS_ToFloat64(ctx, &x, argv[0]))
+	if (JS_RL_TO_FLOAT64(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &y, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &y, argv[1]))
 		return JS_EXCEPTION;
 
 	SetMouseScale((float)x, (float)y);
@@ -1083,7 +1249,7 @@ static JSValue rl_set_mouse_scale(JSContext* ctx, JSValueConst this_val, int arg
 
 static JSValue rl_get_mouse_wheel_move(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetMouseWheelMove());
+	return JS_NewInt32(ctx, js_rl_get_mouse_wheel_move());
 }
 
 #pragma endregion
@@ -1091,35 +1257,24 @@ static JSValue rl_get_mouse_wheel_move(JSContext* ctx, JSValueConst this_val, in
 
 static JSValue rl_get_touch_x(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetTouchX());
+	return JS_NewInt32(ctx, js_rl_get_touch_x());
 }
 
 static JSValue rl_get_touch_y(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetTouchY());
+	return JS_NewInt32(ctx, js_rl_get_touch_y());
 }
 
 static JSValue rl_get_touch_position(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int index;
 
-	if (JS_ToInt32(ctx, &index, argv[0]))
-		return JS_EXCEPTION;
-
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
-	Vector2 mousePos = GetMousePosition();
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	if (JS_RL_TO_INT32(ctx, &index, argv[0]))
 		return JS_EXCEPTION;
-	}
 
-	memcpy(p, &mousePos, sizeof(Vector2));
-	JS_SetOpaque(obj, p);
+	Vector2 touchPos = js_rl_get_touch_position(index);
 
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR2, &touchPos, argc, argv, 1);
 }
 
 #pragma endregion
@@ -1129,7 +1284,7 @@ static JSValue rl_set_gestures_enabled(JSContext* ctx, JSValueConst this_val, in
 {
 	unsigned int flags;
 
-	if (JS_ToUint32(ctx, &flags, argv[0]))
+	if (JS_RL_TO_UINT32(ctx, &flags, argv[0]))
 		return JS_EXCEPTION;
 
 	SetGesturesEnabled(flags);
@@ -1141,71 +1296,49 @@ static JSValue rl_is_gesture_detected(JSContext* ctx, JSValueConst this_val, int
 {
 	int gesture;
 
-	if (JS_ToInt32(ctx, &gesture, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &gesture, argv[0]))
 		return JS_EXCEPTION;
 
-	return JS_NewBool(ctx, IsGestureDetected(gesture));
+	return JS_NewBool(ctx, js_rl_is_gesture_detected(gesture));
 }
 
 static JSValue rl_get_gesture_detected(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetGestureDetected());
+	return JS_NewInt32(ctx, js_rl_get_gesture_detected());
 }
 
 static JSValue rl_get_touch_points_count(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewInt32(ctx, GetTouchPointsCount());
+	return JS_NewInt32(ctx, js_rl_get_touch_points_count());
 }
 
 static JSValue rl_get_gesture_hold_duration(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewFloat64(ctx, GetGestureHoldDuration());
+	return JS_NewFloat64(ctx, js_rl_get_gesture_hold_duration());
 }
 
 static JSValue rl_get_gesture_drag_vector(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
-	Vector2 dragVector = GetGestureDragVector();
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	memcpy(p, &dragVector, sizeof(Vector2));
-	JS_SetOpaque(obj, p);
+	Vector2 dragVector = js_rl_get_gesture_drag_vector();
 
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR2, &dragVector, argc, argv, 0);
 }
 
 static JSValue rl_get_gesture_drag_angle(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewFloat64(ctx, GetGestureDragAngle());
+	return JS_NewFloat64(ctx, js_rl_get_gesture_drag_angle());
 }
 
 static JSValue rl_get_gesture_pinch_vector(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
-	Vector2 pinchVector = GetGestureDragVector();
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	memcpy(p, &pinchVector, sizeof(Vector2));
-	JS_SetOpaque(obj, p);
+	Vector2 pinchVector = js_rl_get_gesture_pinch_vector();
 
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR2, &pinchVector, argc, argv, 0);
 }
 
 static JSValue rl_get_gesture_pinch_angle(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	return JS_NewFloat64(ctx, GetGesturePinchAngle());
+	return JS_NewFloat64(ctx, js_rl_get_gesture_pinch_angle());
 }
 
 #pragma endregion
@@ -1215,10 +1348,10 @@ static JSValue rl_set_camera_mode(JSContext* ctx, JSValueConst this_val, int arg
 {
 	int mode;
 
-	if (JS_ToInt32(ctx, &mode, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &mode, argv[1]))
 		return JS_EXCEPTION;
 
-	Camera camera = *(Camera*)JS_GetOpaque2(ctx, argv[0], js_rl_camera3d_class_id);
+	JS_RL_ARG_VALUE(ctx, Camera, camera, argv[0], js_rl_camera3d_class_id);
 
 	SetCameraMode(camera, mode);
 
@@ -1227,7 +1360,7 @@ static JSValue rl_set_camera_mode(JSContext* ctx, JSValueConst this_val, int arg
 
 static JSValue rl_update_camera(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Camera* camera = (Camera*)JS_GetOpaque2(ctx, argv[0], js_rl_camera3d_class_id);
+	JS_RL_ARG_POINTER(ctx, Camera, camera, argv[0], js_rl_camera3d_class_id);
 	UpdateCamera(camera);
 	return JS_UNDEFINED;
 }
@@ -1236,7 +1369,7 @@ static JSValue rl_set_camera_pan_control(JSContext* ctx, JSValueConst this_val,
 {
 	int panKey;
 
-	if (JS_ToInt32(ctx, &panKey, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &panKey, argv[0]))
 		return JS_EXCEPTION;
 
 	SetCameraPanControl(panKey);
@@ -1248,7 +1381,7 @@ static JSValue rl_set_camera_alt_control(JSContext* ctx, JSValueConst this_val,
 {
 	int altKey;
 
-	if (JS_ToInt32(ctx, &altKey, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &altKey, argv[0]))
 		return JS_EXCEPTION;
 
 	SetCameraAltControl(altKey);
@@ -1260,7 +1393,7 @@ static JSValue rl_set_camera_smooth_zoom_control(JSContext* ctx, JSValueConst th
 {
 	int szKey;
 
-	if (JS_ToInt32(ctx, &szKey, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &szKey, argv[0]))
 		return JS_EXCEPTION;
 
 	SetCameraSmoothZoomControl(szKey);
@@ -1272,22 +1405,22 @@ static JSValue rl_set_camera_move_controls(JSContext* ctx, JSValueConst this_val
 {
 	int frontKey, backKey, rightKey, leftKey, upKey, downKey;
 
-	if (JS_ToInt32(ctx, &frontKey, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &frontKey, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &backKey, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &backKey, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &rightKey, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &rightKey, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &leftKey, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &leftKey, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &upKey, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &upKey, argv[4]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &downKey, argv[5]))
+	if (JS_RL_TO_INT32(ctx, &downKey, argv[5]))
 		return JS_EXCEPTION;
 
 	SetCameraMoveControls(frontKey, backKey, rightKey, leftKey, upKey, downKey);
@@ -1304,13 +1437,13 @@ static JSValue rl_draw_pixel(JSContext* ctx, JSValueConst this_val, int argc, JS
 {
 	int posX, posY;
 
-	if (JS_ToInt32(ctx, &posX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &posX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &posY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &posY, argv[1]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawPixel(posX, posY, color);
 
@@ -1319,8 +1452,8 @@ static JSValue rl_draw_pixel(JSContext* ctx, JSValueConst this_val, int argc, JS
 
 static JSValue rl_draw_pixel_v(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 position = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, position, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[1], js_rl_color_class_id);
 
 	DrawPixelV(position, color);
 
@@ -1331,19 +1464,19 @@ static JSValue rl_draw_line(JSContext* ctx, JSValueConst this_val, int argc, JSV
 {
 	int startPosX, startPosY, endPosX, endPosY;
 
-	if (JS_ToInt32(ctx, &startPosX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &startPosX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &startPosY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &startPosY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &endPosX, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &endPosX, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &endPosY, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &endPosY, argv[3]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawLine(startPosX, startPosY, endPosX, endPosY, color);
 
@@ -1352,9 +1485,9 @@ static JSValue rl_draw_line(JSContext* ctx, JSValueConst this_val, int argc, JSV
 
 static JSValue rl_draw_line_v(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 startPos = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 endPos = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, startPos, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, endPos, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawLineV(startPos, endPos, color);
 
@@ -1363,15 +1496,15 @@ static JSValue rl_draw_line_v(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_draw_line_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 startPos = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 endPos = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, startPos, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, endPos, argv[1], js_rl_vector2_class_id);
 
 	double thick;
 
-	if (JS_ToFloat64(ctx, &thick, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &thick, argv[2]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawLineEx(startPos, endPos, thick, color);
 
@@ -1380,44 +1513,159 @@ static JSValue rl_draw_line_ex(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_draw_line_bezier(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 startPos = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 endPos = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, startPos, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, endPos, argv[1], js_rl_vector2_class_id);
 
 	double thick;
 
-	if (JS_ToFloat64(ctx, &thick, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &thick, argv[2]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawLineBezier(startPos, endPos, thick, color);
 
 	return JS_UNDEFINED;
 }
 
-static JSValue rl_draw_line_strip(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+// Resolves a list of points given as a Vector2Array, a Float32Array of xy
+// pairs or an array of Vector2. Only the latter needs a copy, returned in
+// `owned` for the caller to free.
+static const Vector2* js_rl_get_points(JSContext* ctx, JSValueConst val, uint32_t* count, Vector2** owned)
 {
-	JSValue len_val = JS_GetProperty(ctx, argv[0], JS_ATOM_length);
-	if (JS_IsException(len_val))
-		return JS_EXCEPTION;
-	
-	int numPoints;
+	*owned = NULL;
 
-	if (JS_ToInt32(ctx, &numPoints, len_val))
-		return JS_EXCEPTION;
+	if (JS_GetOpaque(val, js_rl_vector2_array_class_id))
+		return (const Vector2*)js_rl_get_struct_array(ctx, val, js_rl_vector2_array_class_id, count);
+
+	if (!JS_IsArray(ctx, val))
+	{
+		int is_float32 = js_rl_is_typed_array(ctx, val, "Float32Array");
+
+		if (is_float32 <= 0)
+		{
+			if (is_float32 == 0)
+				JS_ThrowTypeError(ctx, "points must be an array of Vector2, a Vector2Array or a Float32Array");
+
+			return NULL;
+		}
+
+		size_t size;
+		uint8_t* data = js_rl_get_array_buffer(ctx, val, &size);
+
+		if (!data)
+			return NULL;
 
-	Vector2 points[numPoints];
+		if ((uintptr_t)data % sizeof(float) || size % sizeof(Vector2))
+		{
+			JS_ThrowRangeError(ctx, "points must be a Float32Array of x, y pairs");
+			return NULL;
+		}
+
+		*count = size / sizeof(Vector2);
+
+		return (const Vector2*)data;
+	}
 
-	for (int i = 0; i < numPoints; i++)
+	JSValue len_val = JS_GetProperty(ctx, val, JS_ATOM_length);
+
+	if (JS_RL_TO_UINT32(ctx, count, len_val))
 	{
-		JSValue value = JS_GetPropertyUint32(ctx, argv[0], i);
-		points[i] = *(Vector2*)JS_GetOpaque2(ctx, value, js_rl_vector2_class_id);
+		JS_FreeValue(ctx, len_val);
+		return NULL;
 	}
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
-	DrawLineStrip(points, numPoints, color);
-	
-	return JS_UNDEFINED;
+	JS_FreeValue(ctx, len_val);
+
+	Vector2* points = js_malloc(ctx, max_int(*count, 1) * sizeof(Vector2));
+
+	if (!points)
+		return NULL;
+
+	for (uint32_t i = 0; i < *count; i++)
+	{
+		JSValue value = JS_GetPropertyUint32(ctx, val, i);
+		Vector2* point = (Vector2*)JS_RL_GET_OPAQUE(ctx, value, js_rl_vector2_class_id);
+		JS_FreeValue(ctx, value);
+
+		if (!point)
+		{
+			js_free(ctx, points);
+			return NULL;
+		}
+
+		points[i] = *point;
+	}
+
+	*owned = points;
+
+	return points;
+}
+
+// raylib's MAX_BATCH_ELEMENTS: the lines batch holds twice as many vertices
+// and the quads batch four times as many, the rest of a longer strip or fan
+// is dropped. Both are drawn in chunks of half a batch so a flush always
+// leaves room for one.
+#ifndef JS_RL_BATCH_ELEMENTS
+#define JS_RL_BATCH_ELEMENTS 8192
+#endif
+
+#define JS_RL_BATCH_CHUNK (JS_RL_BATCH_ELEMENTS / 2)
+
+// Draws `count` points as line segments, consecutive chunks sharing their endpoint
+static void js_rl_draw_line_strip_chunked(const Vector2* points, uint32_t count, Color color)
+{
+	while (count > JS_RL_BATCH_CHUNK + 1)
+	{
+		DrawLineStrip((Vector2*)points, JS_RL_BATCH_CHUNK + 1, color);
+		points += JS_RL_BATCH_CHUNK;
+		count -= JS_RL_BATCH_CHUNK;
+	}
+
+	DrawLineStrip((Vector2*)points, count, color);
+}
+
+// Draws a triangle fan around points[0], each chunk after the first repeating
+// the centre and the last edge point of the previous one
+static void js_rl_draw_triangle_fan_chunked(const Vector2* points, uint32_t count, Color color)
+{
+	// 32 KB with the default batch size
+	Vector2 fan[JS_RL_BATCH_CHUNK + 2];
+
+	if (count <= JS_RL_BATCH_CHUNK + 2)
+	{
+		DrawTriangleFan((Vector2*)points, count, color);
+		return;
+	}
+
+	fan[0] = points[0];
+
+	for (uint32_t start = 1; start + 1 < count; start += JS_RL_BATCH_CHUNK)
+	{
+		uint32_t edge = min_int(count - start, JS_RL_BATCH_CHUNK + 1);
+
+		memcpy(fan + 1, points + start, edge * sizeof(Vector2));
+		DrawTriangleFan(fan, edge + 1, color);
+	}
+}
+
+static JSValue rl_draw_line_strip(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t numPoints;
+	Vector2* owned;
+	const Vector2* points = js_rl_get_points(ctx, argv[0], &numPoints, &owned);
+
+	if (!points)
+		return JS_EXCEPTION;
+
+	Color* color = (Color*)JS_RL_GET_OPAQUE(ctx, argv[1], js_rl_color_class_id);
+
+	if (color)
+		js_rl_draw_line_strip_chunked(points, numPoints, *color);
+
+	js_free(ctx, owned);
+
+	return color ? JS_UNDEFINED : JS_EXCEPTION;
 }
 
 static JSValue rl_draw_circle(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
@@ -1425,16 +1673,16 @@ static JSValue rl_draw_circle(JSContext* ctx, JSValueConst this_val, int argc, J
 	int centerX, centerY;
 	double radius;
 
-	if (JS_ToInt32(ctx, &centerX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &centerX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &centerY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &centerY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &radius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[2]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawCircle(centerX, centerY, radius, color);
 	
@@ -1446,16 +1694,16 @@ static JSValue rl_draw_circle_lines(JSContext* ctx, JSValueConst this_val, int a
 	int centerX, centerY;
 	double radius;
 
-	if (JS_ToInt32(ctx, &centerX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &centerX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &centerY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &centerY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &radius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[2]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawCircleLines(centerX, centerY, radius, color);
 	
@@ -1467,20 +1715,20 @@ static JSValue rl_draw_circle_sector(JSContext* ctx, JSValueConst this_val, int
 	double radius;
 	int startAngle, endAngle, segments;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &startAngle, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &startAngle, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &endAngle, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &endAngle, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &segments, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &segments, argv[4]))
 		return JS_EXCEPTION;
 
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[5], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[5], js_rl_color_class_id);
 
 	DrawCircleSector(center, radius, startAngle, endAngle, segments, color);
 	
@@ -1492,20 +1740,20 @@ static JSValue rl_draw_circle_sector_lines(JSContext* ctx, JSValueConst this_val
 	double radius;
 	int startAngle, endAngle, segments;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &startAngle, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &startAngle, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &endAngle, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &endAngle, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &segments, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &segments, argv[4]))
 		return JS_EXCEPTION;
 
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[5], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[5], js_rl_color_class_id);
 
 	DrawCircleSectorLines(center, radius, startAngle, endAngle, segments, color);
 	
@@ -1517,17 +1765,17 @@ static JSValue rl_draw_circle_gradient(JSContext* ctx, JSValueConst this_val, in
 	int centerX, centerY;
 	double radius;
 
-	if (JS_ToInt32(ctx, &centerX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &centerX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &centerY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &centerY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &radius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[2]))
 		return JS_EXCEPTION;
 
-	Color color1 = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
-	Color color2 = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color1, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color2, argv[4], js_rl_color_class_id);
 
 	DrawCircleGradient(centerX, centerY, radius, color1, color2);
 	
@@ -1538,11 +1786,11 @@ static JSValue rl_draw_circle_v(JSContext* ctx, JSValueConst this_val, int argc,
 {
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawCircleV(center, radius, color);
 	
@@ -1554,23 +1802,23 @@ static JSValue rl_draw_ring(JSContext* ctx, JSValueConst this_val, int argc, JSV
 	double innerRadius, outerRadius;
 	int startAngle, endAngle, segments;
 
-	if (JS_ToFloat64(ctx, &innerRadius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &innerRadius, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &outerRadius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &outerRadius, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &startAngle, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &startAngle, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &endAngle, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &endAngle, argv[4]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &segments, argv[5]))
+	if (JS_RL_TO_INT32(ctx, &segments, argv[5]))
 		return JS_EXCEPTION;
 
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[6], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[6], js_rl_color_class_id);
 
 	DrawRing(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
 	
@@ -1582,23 +1830,23 @@ static JSValue rl_draw_ring_lines(JSContext* ctx, JSValueConst this_val, int arg
 	double innerRadius, outerRadius;
 	int startAngle, endAngle, segments;
 
-	if (JS_ToFloat64(ctx, &innerRadius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &innerRadius, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &outerRadius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &outerRadius, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &startAngle, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &startAngle, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &endAngle, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &endAngle, argv[4]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &segments, argv[5]))
+	if (JS_RL_TO_INT32(ctx, &segments, argv[5]))
 		return JS_EXCEPTION;
 
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[6], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[6], js_rl_color_class_id);
 
 	DrawRingLines(center, innerRadius, outerRadius, startAngle, endAngle, segments, color);
 	
@@ -1609,19 +1857,19 @@ static JSValue rl_draw_rectangle(JSContext* ctx, JSValueConst this_val, int argc
 {
 	int posX, posY, width, height;
 
-	if (JS_ToInt32(ctx, &posX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &posX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &posY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &posY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &width, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawRectangle(posX, posY, width, height, color);
 	
@@ -1630,9 +1878,9 @@ static JSValue rl_draw_rectangle(JSContext* ctx, JSValueConst this_val, int argc
 
 static JSValue rl_draw_rectangle_v(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 position = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 size = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, position, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, size, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawRectangleV(position, size, color);
 	
@@ -1641,8 +1889,8 @@ static JSValue rl_draw_rectangle_v(JSContext* ctx, JSValueConst this_val, int ar
 
 static JSValue rl_draw_rectangle_rec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[1], js_rl_color_class_id);
 
 	DrawRectangleRec(rect, color);
 	
@@ -1653,12 +1901,12 @@ static JSValue rl_draw_rectangle_pro(JSContext* ctx, JSValueConst this_val, int
 {
 	double rotation;
 
-	if (JS_ToFloat64(ctx, &rotation, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &rotation, argv[2]))
 		return JS_EXCEPTION;
 
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Vector2 origin = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, origin, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawRectanglePro(rect, origin, rotation, color);
 	
@@ -1669,20 +1917,20 @@ static JSValue rl_draw_rectangle_gradient_v(JSContext* ctx, JSValueConst this_va
 {
 	int posX, posY, width, height;
 
-	if (JS_ToInt32(ctx, &posX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &posX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &posY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &posY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &width, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
-	Color color1 = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-	Color color2 = *(Color*)JS_GetOpaque2(ctx, argv[5], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color1, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color2, argv[5], js_rl_color_class_id);
 
 	DrawRectangleGradientV(posX, posY, width, height, color1, color2);
 	
@@ -1693,20 +1941,20 @@ static JSValue rl_draw_rectangle_gradient_h(JSContext* ctx, JSValueConst this_va
 {
 	int posX, posY, width, height;
 
-	if (JS_ToInt32(ctx, &posX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &posX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &posY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &posY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &width, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
-	Color color1 = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-	Color color2 = *(Color*)JS_GetOpaque2(ctx, argv[5], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color1, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color2, argv[5], js_rl_color_class_id);
 
 	DrawRectangleGradientH(posX, posY, width, height, color1, color2);
 	
@@ -1715,11 +1963,11 @@ static JSValue rl_draw_rectangle_gradient_h(JSContext* ctx, JSValueConst this_va
 
 static JSValue rl_draw_rectangle_gradient_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[1], js_rl_rectangle_class_id);
-	Color color1 = *(Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
-	Color color2 = *(Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
-	Color color3 = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
-	Color color4 = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[1], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color1, argv[1], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color2, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color3, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color4, argv[4], js_rl_color_class_id);
 
 	DrawRectangleGradientEx(rect, color1, color2, color3, color4);
 	
@@ -1730,19 +1978,19 @@ static JSValue rl_draw_rectangle_lines(JSContext* ctx, JSValueConst this_val, in
 {
 	int posX, posY, width, height;
 
-	if (JS_ToInt32(ctx, &posX, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &posX, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &posY, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &posY, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &width, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawRectangleLines(posX, posY, width, height, color);
 	
@@ -1753,11 +2001,11 @@ static JSValue rl_draw_rectangle_lines_ex(JSContext* ctx, JSValueConst this_val,
 {
 	int lineThick;
 
-	if (JS_ToInt32(ctx, &lineThick, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &lineThick, argv[1]))
 		return JS_EXCEPTION;
 
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawRectangleLinesEx(rect, lineThick, color);
 	
@@ -1769,14 +2017,14 @@ static JSValue rl_draw_rectangle_rounded(JSContext* ctx, JSValueConst this_val,
 	double roundness;
 	int segments;
 
-	if (JS_ToFloat64(ctx, &roundness, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &roundness, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &segments, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &segments, argv[2]))
 		return JS_EXCEPTION;
 
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawRectangleRounded(rect, roundness, segments, color);
 	
@@ -1788,17 +2036,17 @@ static JSValue rl_draw_rectangle_rounded_lines(JSContext* ctx, JSValueConst this
 	double roundness;
 	int segments, lineThick;
 
-	if (JS_ToFloat64(ctx, &roundness, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &roundness, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &segments, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &segments, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &lineThick, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &lineThick, argv[3]))
 		return JS_EXCEPTION;
 
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawRectangleRoundedLines(rect, roundness, segments, lineThick, color);
 	
@@ -1807,10 +2055,10 @@ static JSValue rl_draw_rectangle_rounded_lines(JSContext* ctx, JSValueConst this
 
 static JSValue rl_draw_triangle(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 v1 = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 v2 = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-	Vector2 v3 = *(Vector2*)JS_GetOpaque2(ctx, argv[2], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, v1, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, v2, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, v3, argv[2], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawTriangle(v1, v2, v3, color);
 	
@@ -1819,10 +2067,10 @@ static JSValue rl_draw_triangle(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_draw_triangle_lines(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 v1 = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 v2 = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-	Vector2 v3 = *(Vector2*)JS_GetOpaque2(ctx, argv[2], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[3], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, v1, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, v2, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, v3, argv[2], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[3], js_rl_color_class_id);
 
 	DrawTriangleLines(v1, v2, v3, color);
 	
@@ -1831,26 +2079,189 @@ static JSValue rl_draw_triangle_lines(JSContext* ctx, JSValueConst this_val, int
 
 static JSValue rl_draw_triangle_fan(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue len_val = JS_GetProperty(ctx, argv[0], JS_ATOM_length);
-	if (JS_IsException(len_val))
+	uint32_t numPoints;
+	Vector2* owned;
+	const Vector2* points = js_rl_get_points(ctx, argv[0], &numPoints, &owned);
+
+	if (!points)
 		return JS_EXCEPTION;
-	
-	int numPoints;
 
-	if (JS_ToInt32(ctx, &numPoints, len_val))
+	Color* color = (Color*)JS_RL_GET_OPAQUE(ctx, argv[1], js_rl_color_class_id);
+
+	if (color)
+		js_rl_draw_triangle_fan_chunked(points, numPoints, *color);
+
+	js_free(ctx, owned);
+
+	return color ? JS_UNDEFINED : JS_EXCEPTION;
+}
+
+// Draws a triangle whatever the order of its vertices: raylib expects them
+// counter-clockwise on screen and culls the other winding
+static void js_rl_draw_triangle_unordered(Vector2 a, Vector2 b, Vector2 c, Color color)
+{
+	if ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x) > 0.0f)
+		DrawTriangle(a, c, b, color);
+	else
+		DrawTriangle(a, b, c, color);
+}
+
+static JSValue rl_draw_triangle_strip(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t numPoints;
+	Vector2* owned;
+	const Vector2* points = js_rl_get_points(ctx, argv[0], &numPoints, &owned);
+
+	if (!points)
 		return JS_EXCEPTION;
 
-	Vector2 points[numPoints];
+	Color* color = (Color*)JS_RL_GET_OPAQUE(ctx, argv[1], js_rl_color_class_id);
 
-	for (int i = 0; i < numPoints; i++)
+	if (color)
 	{
-		JSValue value = JS_GetPropertyUint32(ctx, argv[0], i);
-		points[i] = *(Vector2*)JS_GetOpaque2(ctx, value, js_rl_vector2_class_id);
+		// raylib 2.5 has no DrawTriangleStrip(), winding alternates along the strip
+		for (uint32_t i = 2; i < numPoints; i++)
+		{
+			if (i % 2 == 0)
+				DrawTriangle(points[i], points[i - 2], points[i - 1], *color);
+			else
+				DrawTriangle(points[i], points[i - 1], points[i - 2], *color);
+		}
 	}
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
-	DrawTriangleFan(points, numPoints, color);
-	
+	js_free(ctx, owned);
+
+	return color ? JS_UNDEFINED : JS_EXCEPTION;
+}
+
+enum
+{
+	JS_RL_LINE_JOIN_MITER,
+	JS_RL_LINE_JOIN_BEVEL,
+	JS_RL_LINE_JOIN_ROUND,
+};
+
+// Miters longer than this many half-thicknesses are beveled instead
+#define JS_RL_MITER_LIMIT 4.0f
+
+static void js_rl_draw_line_join(Vector2 p, Vector2 n0, Vector2 n1, Vector2 d0, Vector2 d1, float half, int join, Color color)
+{
+	if (join == JS_RL_LINE_JOIN_ROUND)
+	{
+		DrawCircleV(p, half, color);
+		return;
+	}
+
+	// Only the outer side of the turn has a gap, the inner side is covered by the segments
+	float side = d0.x * d1.y - d0.y * d1.x > 0.0f ? -1.0f : 1.0f;
+	Vector2 a = { p.x + n0.x * half * side, p.y + n0.y * half * side };
+	Vector2 b = { p.x + n1.x * half * side, p.y + n1.y * half * side };
+
+	if (join == JS_RL_LINE_JOIN_MITER)
+	{
+		Vector2 m = { n0.x + n1.x, n0.y + n1.y };
+		float length = sqrtf(m.x * m.x + m.y * m.y);
+		float cosine = length > 0.0f ? (m.x * n0.x + m.y * n0.y) / length : 0.0f;
+
+		if (cosine > 1.0f / JS_RL_MITER_LIMIT)
+		{
+			float extent = half / cosine / length * side;
+			Vector2 tip = { p.x + m.x * extent, p.y + m.y * extent };
+
+			js_rl_draw_triangle_unordered(p, a, tip, color);
+			js_rl_draw_triangle_unordered(p, tip, b, color);
+			return;
+		}
+	}
+
+	js_rl_draw_triangle_unordered(p, a, b, color);
+}
+
+static void js_rl_draw_polyline(const Vector2* points, uint32_t count, float thick, int join, BOOL closed, Color color)
+{
+	float half = thick / 2.0f;
+	uint32_t segments = closed ? count : count - 1;
+	BOOL started = FALSE;
+	Vector2 first_n = { 0 }, first_d = { 0 }, prev_n = { 0 }, prev_d = { 0 };
+
+	for (uint32_t i = 0; i < segments; i++)
+	{
+		Vector2 a = points[i], b = points[(i + 1) % count];
+		Vector2 d = { b.x - a.x, b.y - a.y };
+		float length = sqrtf(d.x * d.x + d.y * d.y);
+
+		// Repeated points carry no direction
+		if (length == 0.0f)
+			continue;
+
+		d.x /= length;
+		d.y /= length;
+
+		Vector2 n = { -d.y, d.x };
+		Vector2 o = { n.x * half, n.y * half };
+
+		Vector2 a0 = { a.x + o.x, a.y + o.y }, a1 = { a.x - o.x, a.y - o.y };
+		Vector2 b0 = { b.x + o.x, b.y + o.y }, b1 = { b.x - o.x, b.y - o.y };
+
+		js_rl_draw_triangle_unordered(a0, a1, b1, color);
+		js_rl_draw_triangle_unordered(a0, b1, b0, color);
+
+		if (started)
+			js_rl_draw_line_join(a, prev_n, n, prev_d, d, half, join, color);
+		else
+		{
+			first_n = n;
+			first_d = d;
+			started = TRUE;
+		}
+
+		prev_n = n;
+		prev_d = d;
+	}
+
+	if (closed && started)
+		js_rl_draw_line_join(points[0], prev_n, first_n, prev_d, first_d, half, join, color);
+}
+
+static JSValue rl_draw_polyline(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	double thick;
+	int join = JS_RL_LINE_JOIN_MITER;
+	BOOL closed = FALSE;
+
+	if (JS_RL_TO_FLOAT64(ctx, &thick, argv[1]))
+		return JS_EXCEPTION;
+
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[2], js_rl_color_class_id);
+
+	if (!JS_IsUndefined(argv[3]) && JS_RL_TO_INT32(ctx, &join, argv[3]))
+		return JS_EXCEPTION;
+
+	if (!JS_IsUndefined(argv[4]))
+		closed = JS_ToBool(ctx, argv[4]);
+
+	uint32_t numPoints;
+	Vector2* owned;
+	const Vector2* points = js_rl_get_points(ctx, argv[0], &numPoints, &owned);
+
+	if (!points)
+		return JS_EXCEPTION;
+
+	if (numPoints >= 2)
+	{
+		if (thick <= 1.0)
+		{
+			js_rl_draw_line_strip_chunked(points, numPoints, *color);
+
+			if (closed)
+				DrawLineV(points[numPoints - 1], points[0], *color);
+		}
+		else
+			js_rl_draw_polyline(points, numPoints, thick, join, closed, *color);
+	}
+
+	js_free(ctx, owned);
+
 	return JS_UNDEFINED;
 }
 
@@ -1859,17 +2270,17 @@ static JSValue rl_draw_poly(JSContext* ctx, JSValueConst this_val, int argc, JSV
 	double radius, rotation;
 	int sides;
 
-	if (JS_ToInt32(ctx, &sides, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &sides, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &radius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &rotation, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &rotation, argv[3]))
 		return JS_EXCEPTION;
 
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawPoly(center, sides, radius, rotation, color);
 	
@@ -1878,36 +2289,170 @@ static JSValue rl_draw_poly(JSContext* ctx, JSValueConst this_val, int argc, JSV
 
 static JSValue rl_set_shapes_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Texture2D texture = *(Texture2D*)JS_GetOpaque2(ctx, argv[0], js_rl_texture2d_class_id);
-	Rectangle rect = *(Rectangle*)JS_GetOpaque2(ctx, argv[1], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Texture2D, texture, argv[0], js_rl_texture2d_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rect, argv[1], js_rl_rectangle_class_id);
 
 	SetShapesTexture(texture, rect);
 	
 	return JS_UNDEFINED;
 }
 
+#pragma endregion
+#pragma region Batched shapes drawing functions
+
+// Returns packed float geometry holding `stride` floats per instance
+static const float* js_rl_get_batch_geometry(JSContext* ctx, JSValueConst val, int stride, uint32_t* count)
+{
+	size_t size;
+	uint8_t* data = js_rl_get_array_buffer(ctx, val, &size);
+
+	if (!data)
+		return NULL;
+
+	if ((uintptr_t)data % sizeof(float) || size % (stride * sizeof(float)))
+	{
+		JS_ThrowRangeError(ctx, "geometry must be a Float32Array of %d values per instance", stride);
+		return NULL;
+	}
+
+	*count = size / (stride * sizeof(float));
+
+	return (const float*)data;
+}
+
+// Resolves either one color shared by every instance (a Color or a packed
+// number) or one color per instance (a ColorArray or packed 32-bit words)
+static int js_rl_get_batch_colors(JSContext* ctx, JSValueConst val, uint32_t count, Color* single, const Color** colors)
+{
+	*colors = NULL;
+
+	Color* color = (Color*)JS_GetOpaque(val, js_rl_color_class_id);
+
+	if (color)
+	{
+		*single = *color;
+		return 0;
+	}
+
+	if (JS_IsNumber(val))
+	{
+		uint32_t packed;
+
+		if (JS_RL_TO_UINT32(ctx, &packed, val))
+			return -1;
+
+		// 0xRRGGBBAA like every other binding taking a number
+		*single = GetColor((int)packed);
+		return 0;
+	}
+
+	uint32_t length;
+
+	if (JS_GetOpaque(val, js_rl_color_array_class_id))
+	{
+		*colors = (const Color*)js_rl_get_struct_array(ctx, val, js_rl_color_array_class_id, &length);
+	}
+	else
+	{
+		size_t size;
+		*colors = (const Color*)js_rl_get_array_buffer(ctx, val, &size);
+		length = size / sizeof(Color);
+	}
+
+	if (!*colors)
+		return -1;
+
+	if (length < count)
+	{
+		JS_ThrowRangeError(ctx, "%u colors given for %u instances", length, count);
+		return -1;
+	}
+
+	return 0;
+}
+
+static JSValue rl_draw_rectangles(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t count;
+	const float* rects = js_rl_get_batch_geometry(ctx, argv[0], 4, &count);
+
+	if (!rects)
+		return JS_EXCEPTION;
+
+	Color color;
+	const Color* colors;
+
+	if (js_rl_get_batch_colors(ctx, argv[1], count, &color, &colors))
+		return JS_EXCEPTION;
+
+	for (uint32_t i = 0; i < count; i++, rects += 4)
+		DrawRectangleRec((Rectangle){ rects[0], rects[1], rects[2], rects[3] }, colors ? colors[i] : color);
+
+	return JS_UNDEFINED;
+}
+
+static JSValue rl_draw_circles(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t count;
+	const float* circles = js_rl_get_batch_geometry(ctx, argv[0], 3, &count);
+
+	if (!circles)
+		return JS_EXCEPTION;
+
+	Color color;
+	const Color* colors;
+
+	if (js_rl_get_batch_colors(ctx, argv[1], count, &color, &colors))
+		return JS_EXCEPTION;
+
+	for (uint32_t i = 0; i < count; i++, circles += 3)
+		DrawCircleV((Vector2){ circles[0], circles[1] }, circles[2], colors ? colors[i] : color);
+
+	return JS_UNDEFINED;
+}
+
+static JSValue rl_draw_pixels(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t count;
+	const float* points = js_rl_get_batch_geometry(ctx, argv[0], 2, &count);
+
+	if (!points)
+		return JS_EXCEPTION;
+
+	Color color;
+	const Color* colors;
+
+	if (js_rl_get_batch_colors(ctx, argv[1], count, &color, &colors))
+		return JS_EXCEPTION;
+
+	for (uint32_t i = 0; i < count; i++, points += 2)
+		DrawPixelV((Vector2){ points[0], points[1] }, colors ? colors[i] : color);
+
+	return JS_UNDEFINED;
+}
+
 #pragma endregion
 #pragma region Basic shapes collision detection functions
 
 static JSValue rl_check_collision_recs(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Rectangle rec1 = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Rectangle rec2 = *(Rectangle*)JS_GetOpaque2(ctx, argv[1], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec1, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec2, argv[1], js_rl_rectangle_class_id);
 	
 	return JS_NewBool(ctx, CheckCollisionRecs(rec1, rec2));
 }
 
 static JSValue rl_check_collision_circles(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 center1 = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 center2 = *(Vector2*)JS_GetOpaque2(ctx, argv[2], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center1, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center2, argv[2], js_rl_vector2_class_id);
 
 	double radius1, radius2;
 
-	if (JS_ToFloat64(ctx, &radius1, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius1, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &radius2, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius2, argv[3]))
 		return JS_EXCEPTION;
 
 	return JS_NewBool(ctx, CheckCollisionCircles(center1, radius1, center2, radius2));
@@ -1915,12 +2460,12 @@ static JSValue rl_check_collision_circles(JSContext* ctx, JSValueConst this_val,
 
 static JSValue rl_check_collision_circle_rec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Rectangle rec = *(Rectangle*)JS_GetOpaque2(ctx, argv[2], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec, argv[2], js_rl_rectangle_class_id);
 
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
 	return JS_NewBool(ctx, CheckCollisionCircleRec(center, radius, rec));
@@ -1928,40 +2473,30 @@ static JSValue rl_check_collision_circle_rec(JSContext* ctx, JSValueConst this_v
 
 static JSValue rl_get_collision_rec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Rectangle rec1 = *(Rectangle*)JS_GetOpaque2(ctx, argv[0], js_rl_rectangle_class_id);
-	Rectangle rec2 = *(Rectangle*)JS_GetOpaque2(ctx, argv[1], js_rl_rectangle_class_id);
-
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-	Rectangle* p = js_mallocz(ctx, sizeof(Rectangle));
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec1, argv[0], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec2, argv[1], js_rl_rectangle_class_id);
 
 	Rectangle coll = GetCollisionRec(rec1, rec2);
-	memcpy(p, &coll, sizeof(Rectangle));
-	JS_SetOpaque(obj, p);
 
-	return obj;
+	return js_rl_return_struct(ctx, JS_RL_POOL_RECTANGLE, &coll, argc, argv, 2);
 }
 
 static JSValue rl_check_collision_point_rec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 point = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Rectangle rec = *(Rectangle*)JS_GetOpaque2(ctx, argv[1], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, point, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec, argv[1], js_rl_rectangle_class_id);
 
 	return JS_NewBool(ctx, CheckCollisionPointRec(point, rec));
 }
 
 static JSValue rl_check_collision_point_circle(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 point = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 center = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, point, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, center, argv[1], js_rl_vector2_class_id);
 
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[2]))
 		return JS_EXCEPTION;
 
 	return JS_NewBool(ctx, CheckCollisionPointCircle(point, center, radius));
@@ -1969,10 +2504,10 @@ static JSValue rl_check_collision_point_circle(JSContext* ctx, JSValueConst this
 
 static JSValue rl_check_collision_point_triangle(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector2 point = *(Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2 p1 = *(Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-	Vector2 p2 = *(Vector2*)JS_GetOpaque2(ctx, argv[2], js_rl_vector2_class_id);
-	Vector2 p3 = *(Vector2*)JS_GetOpaque2(ctx, argv[3], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, point, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, p1, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, p2, argv[2], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, p3, argv[3], js_rl_vector2_class_id);
 
 	return JS_NewBool(ctx, CheckCollisionPointTriangle(point, p1, p2, p3));
 }
@@ -1984,65 +2519,70 @@ static JSValue rl_check_collision_point_triangle(JSContext* ctx, JSValueConst th
 
 static JSValue rl_load_image(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
 	const char* fileName = NULL;
 
-	fileName = JS_ToCString(ctx, argv[0]);
+	fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
-	Image* p = js_mallocz(ctx, sizeof(Image));
-	Image image = LoadImage(fileName);
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	memcpy(p, &image, sizeof(Image));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_new_image(ctx, LoadImage(fileName));
 }
 
 static JSValue rl_load_image_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int width, height, amount;
 
-	if (JS_ToInt32(ctx, &width, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[2]))
 		return JS_EXCEPTION;
 
 	amount = width * height;
-	Color* pixels = js_mallocz(ctx, sizeof(Color) * amount);
+	Color* pixels;
+	BOOL owned = FALSE;
 
-	for (int i = 0; i < amount; i++)
+	if (JS_GetOpaque(argv[0], js_rl_color_array_class_id))
 	{
-		JSValue color = JS_GetPropertyUint32(ctx, argv[0], i);
-		pixels[i] = *(Color*)JS_GetOpaque2(ctx, color, js_rl_color_class_id);
+		// Packed colors already have raylib's layout and are passed straight through
+		uint32_t length;
+		pixels = (Color*)js_rl_get_struct_array(ctx, argv[0], js_rl_color_array_class_id, &length);
+
+		if (!pixels)
+			return JS_EXCEPTION;
+
+		if ((int64_t)length < amount)
+			return JS_ThrowRangeError(ctx, "ColorArray holds %u colors, %d needed", length, amount);
 	}
+	else
+	{
+		pixels = js_mallocz(ctx, sizeof(Color) * amount);
+		owned = TRUE;
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
+		if (!pixels)
+			return JS_EXCEPTION;
 
-	if (JS_IsException(obj))
-		return obj;
+		for (int i = 0; i < amount; i++)
+		{
+			JSValue color = JS_GetPropertyUint32(ctx, argv[0], i);
+			Color* p = (Color*)JS_RL_GET_OPAQUE(ctx, color, js_rl_color_class_id);
+			JS_FreeValue(ctx, color);
 
-	Image* p = js_mallocz(ctx, sizeof(Image));
+			if (!p)
+			{
+				js_free(ctx, pixels);
+				return JS_EXCEPTION;
+			}
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
+			pixels[i] = *p;
+		}
 	}
 
-	Image image = LoadImageEx(pixels, width, height);
-	memcpy(p, &image, sizeof(Image));
-	JS_SetOpaque(obj, p);
+	// LoadImageEx() copies the pixels into its own buffer
+	JSValue obj = js_rl_new_image(ctx, LoadImageEx(pixels, width, height));
+
+	if (owned)
+		js_free(ctx, pixels);
 
 	return obj;
 }
@@ -2053,13 +2593,13 @@ static JSValue rl_load_image_pro(JSContext* ctx, JSValueConst this_val, int argc
 
 	int width, height, format;
 
-	if (JS_ToInt32(ctx, &width, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &format, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &format, argv[3]))
 		return JS_EXCEPTION;
 
 	// amount = width * height;
@@ -2085,52 +2625,36 @@ static JSValue rl_load_image_pro(JSContext* ctx, JSValueConst this_val, int argc
 
 static JSValue rl_load_image_raw(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = NULL;
-
-	fileName = JS_ToCString(ctx, argv[0]);
-	if (fileName == NULL)
-		return JS_EXCEPTION;
-
 	int width, height, format, headerSize;
 
-	if (JS_ToInt32(ctx, &width, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &format, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &format, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &headerSize, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &headerSize, argv[3]))
 		return JS_EXCEPTION;
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
-	Image* p = js_mallocz(ctx, sizeof(Image));
+	const char* fileName = NULL;
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	fileName = js_rl_get_cached_string(ctx, argv[0]);
+	if (fileName == NULL)
 		return JS_EXCEPTION;
-	}
-
-	Image image = LoadImageRaw(fileName, width, height, format, headerSize);
-	memcpy(p, &image, sizeof(Image));
-	JS_SetOpaque(obj, p);
 
-	return obj;
+	return js_rl_new_image(ctx, LoadImageRaw(fileName, width, height, format, headerSize));
 }
 
 static JSValue rl_export_image(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
+	JS_RL_ARG_VALUE(ctx, Image, image, argv[0], js_rl_image_class_id);
 
 	const char* fileName = NULL;
 
-	fileName = JS_ToCString(ctx, argv[1]);
+	fileName = js_rl_get_cached_string(ctx, argv[1]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -2141,11 +2665,11 @@ static JSValue rl_export_image(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_export_image_as_code(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
+	JS_RL_ARG_VALUE(ctx, Image, image, argv[0], js_rl_image_class_id);
 
 	const char* fileName = NULL;
 
-	fileName = JS_ToCString(ctx, argv[1]);
+	fileName = js_rl_get_cached_string(ctx, argv[1]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
@@ -2158,79 +2682,30 @@ static JSValue rl_load_texture(JSContext* ctx, JSValueConst this_val, int argc,
 {
 	const char* fileName = NULL;
 
-	fileName = JS_ToCString(ctx, argv[0]);
+	fileName = js_rl_get_cached_string(ctx, argv[0]);
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_texture2d_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
-	Texture2D* p = js_mallocz(ctx, sizeof(Texture2D));
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	Texture2D texture = LoadTexture(fileName);
-	memcpy(p, &texture, sizeof(Image));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_new_texture(ctx, LoadTexture(fileName));
 }
 
 static JSValue rl_load_texture_from_image(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_texture2d_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
-	Texture2D* p = js_mallocz(ctx, sizeof(Texture2D));
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
-	Texture2D texture = LoadTextureFromImage(image);
-	memcpy(p, &texture, sizeof(Image));
+	JS_RL_ARG_VALUE(ctx, Image, image, argv[0], js_rl_image_class_id);
 
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_new_texture(ctx, LoadTextureFromImage(image));
 }
 
 static JSValue rl_load_texture_cubemap(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
+	JS_RL_ARG_VALUE(ctx, Image, image, argv[0], js_rl_image_class_id);
 
 	int layoutType;
 
-	if (JS_ToInt32(ctx, &layoutType, argv[1]))
-		return JS_EXCEPTION;
-
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_texture2d_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
-	Texture2D* p = js_mallocz(ctx, sizeof(Texture2D));
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	if (JS_RL_TO_INT32(ctx, &layoutType, argv[1]))
 		return JS_EXCEPTION;
-	}
-
-	Texture2D texture = LoadTextureCubemap(image, layoutType);
-	memcpy(p, &texture, sizeof(Image));
-
-	JS_SetOpaque(obj, p);
 
-	return obj;
+	return js_rl_new_texture(ctx, LoadTextureCubemap(image, layoutType));
 }
 
 static JSValue rl_load_render_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
@@ -2240,64 +2715,107 @@ static JSValue rl_load_render_texture(JSContext* ctx, JSValueConst this_val, int
 
 static JSValue rl_unload_image(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
+	JS_RL_ARG_VALUE(ctx, Image, image, argv[0], js_rl_image_class_id);
 	UnloadImage(image);
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_unload_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Texture2D texture = *(Texture2D*)JS_GetOpaque2(ctx, argv[0], js_rl_texture2d_class_id);
+	JS_RL_ARG_VALUE(ctx, Texture2D, texture, argv[0], js_rl_texture2d_class_id);
 	UnloadTexture(texture);
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_unload_render_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	RenderTexture2D texture = *(RenderTexture2D*)JS_GetOpaque2(ctx, argv[0], js_rl_render_texture_class_id);
+	JS_RL_ARG_VALUE(ctx, RenderTexture2D, texture, argv[0], js_rl_render_texture_class_id);
 	UnloadRenderTexture(texture);
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_get_image_data(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
-	Color* pixels = GetImageData(image);
+	JS_RL_ARG_POINTER(ctx, Image, image, argv[0], js_rl_image_class_id);
+
+	Color* pixels = GetImageData(*image);
 
-	int count = image.width * image.height;
+	int count = image->width * image->height;
 
 	JSValue arr = JS_NewArray(ctx);
 
 	for (int i = 0; i < count; i++)
 	{
-		JSValue obj = JS_NewObjectClass(ctx, js_rl_color_class_id);
-		Color* pixel = js_mallocz(ctx, sizeof(Color));
-		memcpy(pixel, pixels + i, sizeof(Color));
-		JS_SetOpaque(obj, pixel);
+		JSValue obj = js_rl_new_color(ctx, pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a);
 		JS_SetPropertyInt64(ctx, arr, i, obj);
 	}
 
+	free(pixels);
+
 	return arr;
 }
 
 static JSValue rl_get_image_data_normalized(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
-	Vector4* pixels = GetImageDataNormalized(image);
+	JS_RL_ARG_POINTER(ctx, Image, image, argv[0], js_rl_image_class_id);
+
+	Vector4* pixels = GetImageDataNormalized(*image);
 
-	int count = image.width * image.height;
+	int count = image->width * image->height;
 
 	JSValue arr = JS_NewArray(ctx);
 
 	for (int i = 0; i < count; i++)
 	{
-		JSValue obj = JS_NewObjectClass(ctx, js_rl_vector4_class_id);
-		Vector4* pixel = js_mallocz(ctx, sizeof(Vector4));
-		memcpy(pixel, pixels + i, sizeof(Vector4));
-		JS_SetOpaque(obj, pixel);
+		JSValue obj = js_rl_new_vector4(ctx, pixels[i].x, pixels[i].y, pixels[i].z, pixels[i].w);
 		JS_SetPropertyInt64(ctx, arr, i, obj);
 	}
 
+	free(pixels);
+
+	return arr;
+}
+
+static JSValue rl_get_image_data_buffer(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_POINTER(ctx, Image, image, argv[0], js_rl_image_class_id);
+
+	size_t size = (size_t)image->width * image->height * sizeof(Color);
+	Color* pixels = GetImageData(*image);
+
+	if (!pixels)
+		return JS_ThrowOutOfMemory(ctx);
+
+	// The pixel buffer is handed over to the ArrayBuffer as is, no copy involved
+	JSValue buffer = js_rl_wrap_raylib_buffer(ctx, pixels, size);
+
+	if (JS_IsException(buffer))
+		return buffer;
+
+	JSValue arr = js_rl_new_typed_array(ctx, "Uint8Array", buffer, 0, size);
+	JS_FreeValue(ctx, buffer);
+
+	return arr;
+}
+
+static JSValue rl_get_image_data_normalized_buffer(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_POINTER(ctx, Image, image, argv[0], js_rl_image_class_id);
+
+	size_t count = (size_t)image->width * image->height;
+	Vector4* pixels = GetImageDataNormalized(*image);
+
+	if (!pixels)
+		return JS_ThrowOutOfMemory(ctx);
+
+	JSValue buffer = js_rl_wrap_raylib_buffer(ctx, pixels, count * sizeof(Vector4));
+
+	if (JS_IsException(buffer))
+		return buffer;
+
+	JSValue arr = js_rl_new_typed_array(ctx, "Float32Array", buffer, 0, count * 4);
+	JS_FreeValue(ctx, buffer);
+
 	return arr;
 }
 
@@ -2305,13 +2823,13 @@ static JSValue rl_get_pixel_data_size(JSContext* ctx, JSValueConst this_val, int
 {
 	int width, height, format;
 
-	if (JS_ToInt32(ctx, &width, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &width, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &height, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &height, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &format, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &format, argv[2]))
 		return JS_EXCEPTION;
 
 	return JS_NewInt32(ctx, GetPixelDataSize(width, height, format));
@@ -2319,66 +2837,182 @@ static JSValue rl_get_pixel_data_size(JSContext* ctx, JSValueConst this_val, int
 
 static JSValue rl_get_texture_data(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
+	JS_RL_ARG_VALUE(ctx, Texture2D, texture, argv[0], js_rl_texture2d_class_id);
 
-	if (JS_IsException(obj))
-		return obj;
+	return js_rl_new_image(ctx, GetTextureData(texture));
+}
 
-	Image* p = js_mallocz(ctx, sizeof(Image));
+static JSValue rl_get_screen_data(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	return js_rl_new_image(ctx, GetScreenData());
+}
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
+static int js_rl_get_gl_format(int format, GLenum* glFormat, GLenum* glType)
+{
+	// Mirrors the formats rlgl uses on desktop OpenGL 3.3, compressed formats cannot be partially updated
+	switch (format)
+	{
+		case UNCOMPRESSED_GRAYSCALE: *glFormat = GL_RED; *glType = GL_UNSIGNED_BYTE; break;
+		case UNCOMPRESSED_GRAY_ALPHA: *glFormat = GL_RG; *glType = GL_UNSIGNED_BYTE; break;
+		case UNCOMPRESSED_R5G6B5: *glFormat = GL_RGB; *glType = GL_UNSIGNED_SHORT_5_6_5; break;
+		case UNCOMPRESSED_R8G8B8: *glFormat = GL_RGB; *glType = GL_UNSIGNED_BYTE; break;
+		case UNCOMPRESSED_R5G5B5A1: *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_5_5_5_1; break;
+		case UNCOMPRESSED_R4G4B4A4: *glFormat = GL_RGBA; *glType = GL_UNSIGNED_SHORT_4_4_4_4; break;
+		case UNCOMPRESSED_R8G8B8A8: *glFormat = GL_RGBA; *glType = GL_UNSIGNED_BYTE; break;
+		case UNCOMPRESSED_R32: *glFormat = GL_RED; *glType = GL_FLOAT; break;
+		case UNCOMPRESSED_R32G32B32: *glFormat = GL_RGB; *glType = GL_FLOAT; break;
+		case UNCOMPRESSED_R32G32B32A32: *glFormat = GL_RGBA; *glType = GL_FLOAT; break;
+		default: return -1;
 	}
 
-	Texture2D texture = *(Texture2D*)JS_GetOpaque2(ctx, argv[0], js_rl_texture2d_class_id);
-	Image image = GetTextureData(texture);
-	memcpy(p, &image, sizeof(Image));
+	return 0;
+}
 
-	JS_SetOpaque(obj, p);
+static JSValue rl_update_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_POINTER(ctx, Texture2D, texture, argv[0], js_rl_texture2d_class_id);
 
-	return obj;
+	size_t expected = GetPixelDataSize(texture->width, texture->height, texture->format);
+
+	if (JS_IsArray(ctx, argv[1]))
+	{
+		// Plain arrays hold one byte per element in the texture format
+		unsigned char* pixels = js_mallocz(ctx, expected);
+
+		if (!pixels)
+			return JS_EXCEPTION;
+
+		for (size_t i = 0; i < expected; i++)
+		{
+			JSValue obj = JS_GetPropertyUint32(ctx, argv[1], i);
+			int pixel;
+
+			if (JS_RL_TO_INT32(ctx, &pixel, obj))
+			{
+				JS_FreeValue(ctx, obj);
+				js_free(ctx, pixels);
+				return JS_EXCEPTION;
+			}
+
+			JS_FreeValue(ctx, obj);
+			pixels[i] = (unsigned char)pixel;
+		}
+
+		UpdateTexture(*texture, pixels);
+		js_free(ctx, pixels);
+
+		return JS_UNDEFINED;
+	}
+
+	size_t size;
+	uint8_t* pixels = js_rl_get_array_buffer(ctx, argv[1], &size);
+
+	if (!pixels)
+		return JS_EXCEPTION;
+
+	if (size < expected)
+		return JS_ThrowRangeError(ctx, "pixel data is %zu bytes, texture needs %zu", size, expected);
+
+	UpdateTexture(*texture, pixels);
+
+	return JS_UNDEFINED;
 }
 
-static JSValue rl_get_screen_data(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+static JSValue rl_update_texture_rec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
+	JS_RL_ARG_POINTER(ctx, Texture2D, texture, argv[0], js_rl_texture2d_class_id);
 
-	if (JS_IsException(obj))
-		return obj;
+	JS_RL_ARG_POINTER(ctx, Rectangle, rec, argv[1], js_rl_rectangle_class_id);
 
-	Image* p = js_mallocz(ctx, sizeof(Image));
+	int x = (int)rec->x, y = (int)rec->y, width = (int)rec->width, height = (int)rec->height;
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	if (x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > texture->width || y + height > texture->height)
+		return JS_ThrowRangeError(ctx, "rectangle is outside of the %dx%d texture", texture->width, texture->height);
+
+	GLenum glFormat, glType;
+
+	if (js_rl_get_gl_format(texture->format, &glFormat, &glType))
+		return JS_ThrowTypeError(ctx, "texture format %d does not support partial updates", texture->format);
+
+	size_t size;
+	uint8_t* pixels = js_rl_get_array_buffer(ctx, argv[2], &size);
+
+	if (!pixels)
 		return JS_EXCEPTION;
-	}
 
-	Image image = GetScreenData();
-	memcpy(p, &image, sizeof(Image));
+	size_t expected = GetPixelDataSize(width, height, texture->format);
 
-	JS_SetOpaque(obj, p);
+	if (size < expected)
+		return JS_ThrowRangeError(ctx, "pixel data is %zu bytes, rectangle needs %zu", size, expected);
 
-	return obj;
+	glBindTexture(GL_TEXTURE_2D, texture->id);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, glFormat, glType, pixels);
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	return JS_UNDEFINED;
 }
 
-static JSValue rl_update_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+#pragma endregion
+#pragma region Texture2D drawing functions
+
+// Floats per sprite instance: source rect (4), position (2), origin (2), rotation, scale (2), packed tint
+#define JS_RL_SPRITE_FLOATS 12
+
+static JSValue rl_draw_texture_batch(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Texture2D texture = *(Texture2D*)JS_GetOpaque2(ctx, argv[0], js_rl_texture2d_class_id);
+	JS_RL_ARG_POINTER(ctx, Texture2D, texture, argv[0], js_rl_texture2d_class_id);
 
-	int count = texture.width * texture.height;
-	unsigned char* pixels = js_mallocz(ctx, sizeof(unsigned char) * count);
+	uint32_t count;
+	const float* sprite = js_rl_get_batch_geometry(ctx, argv[1], JS_RL_SPRITE_FLOATS, &count);
 
-	for (int i = 0; i < count; i++)
+	if (!sprite)
+		return JS_EXCEPTION;
+
+	if (!JS_IsUndefined(argv[2]))
 	{
-		JSValue obj = JS_GetPropertyUint32(ctx, argv[1], i);
-		int pixel;
-		if (JS_ToInt32(ctx, &pixel, obj))
+		uint32_t limit;
+
+		if (JS_RL_TO_UINT32(ctx, &limit, argv[2]))
 			return JS_EXCEPTION;
-		pixels[i] = (unsigned char)pixel;
+
+		if (limit > count)
+			return JS_ThrowRangeError(ctx, "%u sprites requested, buffer holds %u", limit, count);
+
+		count = limit;
+	}
+
+	// Every quad uses the same texture so rlgl keeps appending to its current
+	// draw call, only flushing when its vertex buffer is full
+	for (uint32_t i = 0; i < count; i++, sprite += JS_RL_SPRITE_FLOATS)
+	{
+		Rectangle source = { sprite[0], sprite[1], sprite[2], sprite[3] };
+		float scaleX = sprite[9], scaleY = sprite[10];
+		Color tint;
+		memcpy(&tint, sprite + 11, sizeof(Color));
+
+		if (tint.a == 0 || scaleX == 0.0f || scaleY == 0.0f)
+			continue;
+
+		// Negative scales mirror the sprite: flip the source instead of the
+		// destination so the quad keeps its winding and survives face culling
+		if (scaleX < 0.0f)
+		{
+			source.width = -source.width;
+			scaleX = -scaleX;
+		}
+
+		if (scaleY < 0.0f)
+		{
+			source.height = -source.height;
+			scaleY = -scaleY;
+		}
+
+		Rectangle dest = { sprite[4], sprite[5], fabsf(sprite[2]) * scaleX, fabsf(sprite[3]) * scaleY };
+		Vector2 origin = { sprite[6] * scaleX, sprite[7] * scaleY };
+
+		DrawTexturePro(*texture, source, dest, origin, sprite[8], tint);
 	}
-	
-	UpdateTexture(texture, pixels);
 
 	return JS_UNDEFINED;
 }
@@ -2390,58 +3024,29 @@ static JSValue rl_update_texture(JSContext* ctx, JSValueConst this_val, int argc
 
 static JSValue rl_get_font_default(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_font_class_id);
-	Font* p = js_mallocz(ctx, sizeof(Font));
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	Font font = GetFontDefault();
-	memcpy(p, &font, sizeof(Font));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	// The default font belongs to raylib, which unloads it in CloseWindow()
+	return js_rl_new_font_view(ctx, GetFontDefault(), JS_NULL);
 }
 
 static JSValue rl_load_font(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	const char* fileName = NULL;
-	fileName = JS_ToCString(ctx, argv[0]);
+	fileName = js_rl_get_cached_string(ctx, argv[0]);
 
 	if (fileName == NULL)
 		return JS_EXCEPTION;
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_font_class_id);
-	Font* p = js_mallocz(ctx, sizeof(Font));
-
-	if (!p) {
-		JS_FreeValue(ctx, obj);
-		return JS_EXCEPTION;
-	}
-
-	Font font = LoadFont(fileName);
-	memcpy(p, &font, sizeof(Font));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_new_font(ctx, LoadFont(fileName));
 }
 
 static JSValue rl_load_font_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = NULL;
-	fileName = JS_ToCString(ctx, argv[0]);
-
-	if (fileName == NULL)
-		return JS_EXCEPTION;
-
 	int fontSize, charsCount;
 
-	if (JS_ToInt32(ctx, &fontSize, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &fontSize, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &charsCount, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &charsCount, argv[3]))
 		return JS_EXCEPTION;
 
 	int fontChars[charsCount];
@@ -2450,42 +3055,30 @@ static JSValue rl_load_font_ex(JSContext* ctx, JSValueConst this_val, int argc,
 	{
 		JSValue value = JS_GetPropertyUint32(ctx, argv[2], i);
 
-		if (JS_ToInt32(ctx, fontChars + i, value))
+		if (JS_RL_TO_INT32(ctx, fontChars + i, value))
 			return JS_EXCEPTION;
 	}
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_font_class_id);
-	Font* p = js_mallocz(ctx, sizeof(Font));
+	const char* fileName = NULL;
+	fileName = js_rl_get_cached_string(ctx, argv[0]);
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	if (fileName == NULL)
 		return JS_EXCEPTION;
-	}
-
-	Font font = LoadFontEx(fileName, fontSize, fontChars, charsCount);
-	memcpy(p, &font, sizeof(Font));
-	JS_SetOpaque(obj, p);
 
-	return obj;
+	return js_rl_new_font(ctx, LoadFontEx(fileName, fontSize, fontChars, charsCount));
 }
 
 static JSValue rl_load_font_data(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	const char* fileName = NULL;
-	fileName = JS_ToCString(ctx, argv[0]);
-
-	if (fileName == NULL)
-		return JS_EXCEPTION;
-
 	int fontSize, charsCount, type;
 
-	if (JS_ToInt32(ctx, &fontSize, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &fontSize, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &charsCount, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &charsCount, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &type, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &type, argv[4]))
 		return JS_EXCEPTION;
 
 	int fontChars[charsCount];
@@ -2494,72 +3087,70 @@ static JSValue rl_load_font_data(JSContext* ctx, JSValueConst this_val, int argc
 	{
 		JSValue value = JS_GetPropertyUint32(ctx, argv[2], i);
 
-		if (JS_ToInt32(ctx, fontChars + i, value))
+		if (JS_RL_TO_INT32(ctx, fontChars + i, value))
 			return JS_EXCEPTION;
 	}
 
-	CharInfo* p = js_mallocz(ctx, sizeof(CharInfo) * charsCount);
-	JSValue arr = JS_NewArray(ctx);
+	const char* fileName = NULL;
+	fileName = js_rl_get_cached_string(ctx, argv[0]);
 
-	if (!p)
-	{
-		JS_FreeValue(ctx, arr);
+	if (fileName == NULL)
 		return JS_EXCEPTION;
-	}
 
 	CharInfo* chars = LoadFontData(fileName, fontSize, fontChars, charsCount, type);
-	memcpy(p, chars, sizeof(CharInfo) * charsCount);
 
-	for (int i = 0; i < charsCount; i++)
+	if (!chars)
+		return JS_ThrowInternalError(ctx, "could not load font data from %s", fileName);
+
+	// Each glyph gets its own wrapper, freed by its finalizer. Only raylib's
+	// array is released here: the glyph images are shared with the copies.
+	JSValue arr = JS_NewArray(ctx);
+
+	for (int i = 0; i < charsCount && !JS_IsException(arr); i++)
 	{
-		JSValue value = JS_NewObjectClass(ctx, js_rl_char_info_class_id);
-		JS_SetOpaque(value, p + i);
-		JS_SetPropertyUint32(ctx, arr, i, value);
+		JSValue value = js_rl_new_char_info(ctx, chars[i]);
+
+		if (JS_IsException(value))
+		{
+			JS_FreeValue(ctx, arr);
+			arr = JS_EXCEPTION;
+		}
+		else
+			JS_SetPropertyUint32(ctx, arr, i, value);
 	}
 
+	free(chars);
+
 	return arr;
 }
 
 static JSValue rl_load_font_from_image(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Image image = *(Image*)JS_GetOpaque2(ctx, argv[0], js_rl_image_class_id);
-	Color key = *(Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Image, image, argv[0], js_rl_image_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, key, argv[1], js_rl_color_class_id);
 
 	int firstChar;
 
-	if (JS_ToInt32(ctx, &firstChar, argv[2]))
-		return JS_EXCEPTION;
-
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_font_class_id);
-	Font* p = js_mallocz(ctx, sizeof(Font));
-
-	if (!p)
-	{
-		JS_FreeValue(ctx, obj);
+	if (JS_RL_TO_INT32(ctx, &firstChar, argv[2]))
 		return JS_EXCEPTION;
-	}
 
-	Font font = LoadFontFromImage(image, key, firstChar);
-	memcpy(p, &font, sizeof(Font));
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_new_font(ctx, LoadFontFromImage(image, key, firstChar));
 }
 
 /*static JSValue rl_get_image_font_atlas(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	int charsCount, fontSize, padding, packMethod;
 
-	if (JS_ToInt32(ctx, &charsCount, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &charsCount, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &fontSize, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &fontSize, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &padding, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &padding, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &packMethod, argv[4]))
+	if (JS_RL_TO_INT32(ctx, &packMethod, argv[4]))
 		return JS_EXCEPTION;
 
 	CharInfo* chars = (CharInfo*)js_mallocz(ctx, sizeof(CharInfo) * charsCount);
@@ -2588,8 +3179,24 @@ static JSValue rl_load_font_from_image(JSContext* ctx, JSValueConst this_val, in
 
 static JSValue rl_unload_font(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Font font = *(Font*)JS_GetOpaque2(ctx, argv[0], js_rl_font_class_id);
-	UnloadFont(font);
+	JS_RL_ARG_POINTER(ctx, JSRLFont, font, argv[0], js_rl_font_class_id);
+
+	// Views leave the font to its owner, an unloaded font isn't unloaded
+	// again by its finalizer
+	if (!JS_IsUndefined(font->owner))
+		return JS_UNDEFINED;
+
+	js_rl_forget_font_layouts(font->font);
+	UnloadFont(font->font);
+	font->owner = JS_NULL;
+
+	// chars and glyphMetrics read an unloaded font as having no glyphs
+	font->font.chars = NULL;
+	font->font.recs = NULL;
+	font->font.charsCount = 0;
+	JS_FreeValue(ctx, font->glyph_metrics);
+	font->glyph_metrics = JS_UNDEFINED;
+
 	return JS_UNDEFINED;
 }
 
@@ -2600,10 +3207,10 @@ static JSValue rl_draw_fps(JSContext* ctx, JSValueConst this_val, int argc, JSVa
 {
 	int x, y;
 
-	if (JS_ToInt32(ctx, &x, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &y, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &y, argv[1]))
 		return JS_EXCEPTION;
 
 	DrawFPS(x, y);
@@ -2614,87 +3221,111 @@ static JSValue rl_draw_fps(JSContext* ctx, JSValueConst this_val, int argc, JSVa
 static JSValue rl_draw_text(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
 	const char* text = NULL;
+	size_t length;
 	int x, y, size, colorInt;
 	Color color = WHITE;
 	
-	text = JS_ToCString(ctx, argv[0]);
-	if (text == NULL)
-		return JS_EXCEPTION;
-
-	if (JS_ToInt32(ctx, &x, argv[1]))
+	if (JS_RL_TO_INT32(ctx, &x, argv[1]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &y, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &y, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &size, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &size, argv[3]))
 		return JS_EXCEPTION;
 
 	if (JS_IsNumber(argv[4]))
 	{
-		if (JS_ToInt32(ctx, &colorInt, argv[4]))
+		if (JS_RL_TO_INT32(ctx, &colorInt, argv[4]))
 			return JS_EXCEPTION;
 		else
 			color = GetColor(colorInt);
 	}
 	else if (JS_IsObject(argv[4]))
-		color = *(Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
+	{
+		JS_RL_ARG_VALUE(ctx, Color, value, argv[4], js_rl_color_class_id);
+		color = value;
+	}
+
+	text = js_rl_get_cached_string_len(ctx, argv[0], &length);
+	if (text == NULL)
+		return JS_EXCEPTION;
+
+	// Same defaults as DrawText, which goes through DrawTextEx with the default font
+	Font font = GetFontDefault();
+
+	if (font.texture.id == 0)
+		return JS_UNDEFINED;
+
+	if (size < 10)
+		size = 10;
 
-	DrawText(text, x, y, size, color);
+	const JSRLTextLayout* layout = js_rl_get_text_layout(font, text, length, (float)size, (float)(size / 10));
+
+	if (layout)
+		js_rl_draw_text_layout(font, layout, (Vector2){ (float)x, (float)y }, color);
+	else
+		DrawText(text, x, y, size, color);
 
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_draw_text_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Font font = *(Font*)JS_GetOpaque2(ctx, argv[0], js_rl_font_class_id);
+	JS_RL_ARG_VALUE(ctx, Font, font, argv[0], js_rl_font_class_id);
 
 	const char* text = NULL;
+	size_t length;
 	
-	text = JS_ToCString(ctx, argv[1]);
-	if (text == NULL)
-		return JS_EXCEPTION;
-
-	Vector2 position = *(Vector2*)JS_GetOpaque2(ctx, argv[2], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, position, argv[2], js_rl_vector2_class_id);
 
 	double fontSize, spacing;
 
-	if (JS_ToFloat64(ctx, &fontSize, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &fontSize, argv[3]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[4]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &spacing, argv[4]))
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[5], js_rl_color_class_id);
+
+	text = js_rl_get_cached_string_len(ctx, argv[1], &length);
+	if (text == NULL)
 		return JS_EXCEPTION;
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[5], js_rl_color_class_id);
+	const JSRLTextLayout* layout = js_rl_get_text_layout(font, text, length, fontSize, spacing);
 
-	DrawTextEx(font, text, position, fontSize, spacing, color);
+	if (layout)
+		js_rl_draw_text_layout(font, layout, position, color);
+	else
+		DrawTextEx(font, text, position, fontSize, spacing, color);
 
 	return JS_UNDEFINED;
 }
 
 static JSValue rl_draw_text_rec(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Font font = *(Font*)JS_GetOpaque2(ctx, argv[0], js_rl_font_class_id);
+	JS_RL_ARG_VALUE(ctx, Font, font, argv[0], js_rl_font_class_id);
 
 	const char* text = NULL;
 	
-	text = JS_ToCString(ctx, argv[1]);
-	if (text == NULL)
-		return JS_EXCEPTION;
-
-	Rectangle rec = *(Rectangle*)JS_GetOpaque2(ctx, argv[2], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec, argv[2], js_rl_rectangle_class_id);
 
 	double fontSize, spacing;
 
-	if (JS_ToFloat64(ctx, &fontSize, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &fontSize, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &spacing, argv[4]))
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[4]))
 		return JS_EXCEPTION;
 
 	bool wordWrap = JS_ToBool(ctx, argv[5]);
 
-	Color color = *(Color*)JS_GetOpaque2(ctx, argv[6], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, color, argv[6], js_rl_color_class_id);
+
+	text = js_rl_get_cached_string(ctx, argv[1]);
+	if (text == NULL)
+		return JS_EXCEPTION;
 
 	DrawTextRec(font, text, rec, fontSize, spacing, wordWrap, color);
 
@@ -2703,106 +3334,271 @@ static JSValue rl_draw_text_rec(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_draw_text_rec_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Font font = *(Font*)JS_GetOpaque2(ctx, argv[0], js_rl_font_class_id);
+	JS_RL_ARG_VALUE(ctx, Font, font, argv[0], js_rl_font_class_id);
 
 	const char* text = NULL;
 	
-	text = JS_ToCString(ctx, argv[1]);
-	if (text == NULL)
-		return JS_EXCEPTION;
-
-	Rectangle rec = *(Rectangle*)JS_GetOpaque2(ctx, argv[2], js_rl_rectangle_class_id);
+	JS_RL_ARG_VALUE(ctx, Rectangle, rec, argv[2], js_rl_rectangle_class_id);
 
 	double fontSize, spacing;
 
-	if (JS_ToFloat64(ctx, &fontSize, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &fontSize, argv[3]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &spacing, argv[4]))
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[4]))
 		return JS_EXCEPTION;
 
 	bool wordWrap = JS_ToBool(ctx, argv[5]);
 
-	Color tint = *(Color*)JS_GetOpaque2(ctx, argv[6], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, tint, argv[6], js_rl_color_class_id);
 
 	int selectStart, selectLength;
 
-	if (JS_ToInt32(ctx, &selectStart, argv[7]))
+	if (JS_RL_TO_INT32(ctx, &selectStart, argv[7]))
 		return JS_EXCEPTION;
 
-	if (JS_ToInt32(ctx, &selectLength, argv[8]))
+	if (JS_RL_TO_INT32(ctx, &selectLength, argv[8]))
 		return JS_EXCEPTION;
 
-	Color selectText = *(Color*)JS_GetOpaque2(ctx, argv[9], js_rl_color_class_id);
-	Color selectBack = *(Color*)JS_GetOpaque2(ctx, argv[10], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, selectText, argv[9], js_rl_color_class_id);
+	JS_RL_ARG_VALUE(ctx, Color, selectBack, argv[10], js_rl_color_class_id);
+
+	text = js_rl_get_cached_string(ctx, argv[1]);
+	if (text == NULL)
+		return JS_EXCEPTION;
 
 	DrawTextRecEx(font, text, rec, fontSize, spacing, wordWrap, tint, selectStart, selectLength, selectText, selectBack);
 
-	return JS_UNDEFINED;
-}
+	return JS_UNDEFINED;
+}
+
+#pragma endregion
+#pragma region Text misc. functions
+
+static JSValue rl_measure_text(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	const char* text = NULL;
+	size_t length;
+	
+	int fontSize;
+
+	if (JS_RL_TO_INT32(ctx, &fontSize, argv[1]))
+		return JS_EXCEPTION;
+
+	text = js_rl_get_cached_string_len(ctx, argv[0], &length);
+	if (text == NULL)
+		return JS_EXCEPTION;
+
+	Font font = GetFontDefault();
+
+	if (font.texture.id == 0)
+		return JS_NewInt32(ctx, 0);
+
+	if (fontSize < 10)
+		fontSize = 10;
+
+	const JSRLTextLayout* layout = js_rl_get_text_layout(font, text, length, (float)fontSize, (float)(fontSize / 10));
+
+	return JS_NewInt32(ctx, layout ? (int)layout->size.x : MeasureText(text, fontSize));
+}
+
+static JSValue rl_measure_text_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Font, font, argv[0], js_rl_font_class_id);
+
+	const char* text = NULL;
+	size_t length;
+	
+	double fontSize, spacing;
+
+	if (JS_RL_TO_FLOAT64(ctx, &fontSize, argv[2]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[3]))
+		return JS_EXCEPTION;
+
+	text = js_rl_get_cached_string_len(ctx, argv[1], &length);
+	if (text == NULL)
+		return JS_EXCEPTION;
+
+	const JSRLTextLayout* layout = js_rl_get_text_layout(font, text, length, fontSize, spacing);
+	Vector2 coll = layout ? layout->size : MeasureTextEx(font, text, fontSize, spacing);
+
+	return js_rl_return_struct(ctx, JS_RL_POOL_VECTOR2, &coll, argc, argv, 4);
+}
+
+static JSValue rl_get_glyph_index(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Font, font, argv[0], js_rl_font_class_id);
+
+	int character;
+
+	if (JS_RL_TO_INT32(ctx, &character, argv[1]))
+		return JS_EXCEPTION;
+
+	return JS_NewInt32(ctx, GetGlyphIndex(font, character));
+}
+
+static JSValue rl_measure_text_batch(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_POINTER(ctx, Font, font, argv[0], js_rl_font_class_id);
+
+	uint32_t count;
+	JSValue len_val = JS_GetProperty(ctx, argv[1], JS_ATOM_length);
+
+	if (JS_RL_TO_UINT32(ctx, &count, len_val))
+	{
+		JS_FreeValue(ctx, len_val);
+		return JS_EXCEPTION;
+	}
+
+	JS_FreeValue(ctx, len_val);
+
+	double fontSize, spacing;
+
+	if (JS_RL_TO_FLOAT64(ctx, &fontSize, argv[2]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[3]))
+		return JS_EXCEPTION;
+
+	JSValue buffer = js_rl_new_array_buffer(ctx, (size_t)count * sizeof(Vector2));
+
+	if (JS_IsException(buffer))
+		return buffer;
 
-#pragma endregion
-#pragma region Text misc. functions
+	size_t size;
+	Vector2* sizes = (Vector2*)JS_GetArrayBuffer(ctx, &size, buffer);
 
-static JSValue rl_measure_text(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
-{
-	const char* text = NULL;
-	
-	text = JS_ToCString(ctx, argv[0]);
-	if (text == NULL)
-		return JS_EXCEPTION;
+	// A batch would flush the string cache of the strings drawn every frame,
+	// so its elements are converted without going through it
+	for (uint32_t i = 0; i < count; i++)
+	{
+		JSValue str = JS_GetPropertyUint32(ctx, argv[1], i);
+		size_t length;
+		const char* text = JS_ToCStringLen(ctx, &length, str);
+		JS_FreeValue(ctx, str);
+
+		if (!text)
+		{
+			JS_FreeValue(ctx, buffer);
+			return JS_EXCEPTION;
+		}
 
-	int fontSize;
+		sizes[i] = js_rl_measure_text_utf8(*font, text, length, fontSize, spacing);
+		JS_FreeCString(ctx, text);
+	}
 
-	if (JS_ToInt32(ctx, &fontSize, argv[1]))
-		return JS_EXCEPTION;
+	JSValue view = js_rl_new_typed_array(ctx, "Float32Array", buffer, 0, (size_t)count * 2);
+	JS_FreeValue(ctx, buffer);
 
-	return JS_NewInt32(ctx, MeasureText(text, fontSize));
+	return view;
 }
 
-static JSValue rl_measure_text_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+static JSValue rl_break_text_lines(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Font font = *(Font*)JS_GetOpaque2(ctx, argv[0], js_rl_font_class_id);
+	JS_RL_ARG_POINTER(ctx, Font, font, argv[0], js_rl_font_class_id);
 
-	const char* text = NULL;
-	
-	text = JS_ToCString(ctx, argv[1]);
-	if (text == NULL)
+	double fontSize, spacing, maxWidth;
+
+	if (JS_RL_TO_FLOAT64(ctx, &fontSize, argv[2]))
 		return JS_EXCEPTION;
 
-	double fontSize, spacing;
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[3]))
+		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &fontSize, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &maxWidth, argv[4]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &spacing, argv[3]))
+	size_t length;
+	const char* text = js_rl_get_cached_string_len(ctx, argv[1], &length);
+
+	if (!text)
 		return JS_EXCEPTION;
 
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
+	// A line never starts twice at the same offset, so there are fewer breaks than bytes
+	uint32_t* breaks = js_malloc(ctx, max_int(length, 1) * sizeof(uint32_t));
 
-	if (!p) {
-		JS_FreeValue(ctx, obj);
+	if (!breaks)
 		return JS_EXCEPTION;
-	}
 
-	Vector2 coll = MeasureTextEx(font, text, fontSize, spacing);
-	memcpy(p, &coll, sizeof(Vector2));
-	JS_SetOpaque(obj, p);
+	float scale = font->baseSize ? fontSize / font->baseSize : 0.0f;
+	uint32_t count = 0;
+	// Offsets are in UTF-16 code units so they can be used with String.prototype.slice
+	uint32_t offset = 0;
+	// x is the pen position, the line width being x - spacing as in MeasureTextEx
+	float x = 0.0f, x_after_space = 0.0f;
+	uint32_t space_break = 0;
+	BOOL has_space = FALSE;
 
-	return obj;
-}
+	for (size_t i = 0; i < length;)
+	{
+		int bytes;
+		int codepoint = js_rl_next_codepoint((const uint8_t*)text + i, length - i, &bytes);
+		uint32_t next = offset + (codepoint >= 0x10000 ? 2 : 1);
+
+		i += bytes;
+
+		if (codepoint == '\n')
+		{
+			breaks[count++] = next;
+			x = 0.0f;
+			has_space = FALSE;
+			offset = next;
+			continue;
+		}
 
-static JSValue rl_get_glyph_index(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
-{
-	Font font = *(Font*)JS_GetOpaque2(ctx, argv[0], js_rl_font_class_id);
+		int index = GetGlyphIndex(*font, codepoint);
+		CharInfo* glyph = &font->chars[index];
+		float advance = (glyph->advanceX ? glyph->advanceX : font->recs[index].width + glyph->offsetX) * scale + spacing;
+
+		if (codepoint == ' ' || codepoint == '\t')
+		{
+			// Trailing spaces may hang past the limit, the line breaks after them
+			x += advance;
+			x_after_space = x;
+			space_break = next;
+			has_space = TRUE;
+		}
+		else if (x > 0.0f && x + advance - spacing > maxWidth)
+		{
+			if (has_space)
+			{
+				// Move the word being built to the next line
+				breaks[count++] = space_break;
+				x = x - x_after_space + advance;
+			}
+			else
+			{
+				// Single word wider than the line: split it before this glyph
+				breaks[count++] = offset;
+				x = advance;
+			}
+
+			has_space = FALSE;
+		}
+		else
+			x += advance;
 
-	int character;
+		offset = next;
+	}
 
-	if (JS_ToInt32(ctx, &character, argv[1]))
-		return JS_EXCEPTION;
+	JSValue buffer = js_rl_new_array_buffer(ctx, count * sizeof(uint32_t));
 
-	return JS_NewInt32(ctx, GetGlyphIndex(font, character));
+	if (JS_IsException(buffer))
+	{
+		js_free(ctx, breaks);
+		return buffer;
+	}
+
+	size_t size;
+	memcpy(JS_GetArrayBuffer(ctx, &size, buffer), breaks, count * sizeof(uint32_t));
+	js_free(ctx, breaks);
+
+	JSValue view = js_rl_new_typed_array(ctx, "Uint32Array", buffer, 0, count);
+	JS_FreeValue(ctx, buffer);
+
+	return view;
 }
 
 #pragma endregion
@@ -2812,20 +3608,11 @@ static JSValue rl_get_glyph_index(JSContext* ctx, JSValueConst this_val, int arg
 
 static JSValue rl_draw_line_3d(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* start = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!start)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, start, argv[0], js_rl_vector3_class_id);
 
-	Vector3* end = (Vector3*)JS_GetOpaque2(ctx, argv[1], js_rl_vector3_class_id);
+	JS_RL_ARG_POINTER(ctx, Vector3, end, argv[1], js_rl_vector3_class_id);
 
-	if (!end)
-		return JS_EXCEPTION;
-
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 
 	DrawLine3D(*start, *end, *color);
@@ -2835,15 +3622,9 @@ static JSValue rl_draw_line_3d(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_draw_point_3d(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* pos = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
+	JS_RL_ARG_POINTER(ctx, Vector3, pos, argv[0], js_rl_vector3_class_id);
 
-	if (!pos)
-		return JS_EXCEPTION;
-
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[1], js_rl_color_class_id);
 
 	DrawPoint3D(*pos, *color);
 
@@ -2852,30 +3633,21 @@ static JSValue rl_draw_point_3d(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_draw_circle_3d(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* center = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!center)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, center, argv[0], js_rl_vector3_class_id);
 
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
-	Vector3* rotationAxis = (Vector3*)JS_GetOpaque2(ctx, argv[2], js_rl_vector3_class_id);
-
-	if (!rotationAxis)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, rotationAxis, argv[2], js_rl_vector3_class_id);
 
 	double rotationAngle;
 
-	if (JS_ToFloat64(ctx, &rotationAngle, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &rotationAngle, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawCircle3D(*center, radius, *rotationAxis, rotationAngle, *color);
 
@@ -2884,30 +3656,24 @@ static JSValue rl_draw_circle_3d(JSContext* ctx, JSValueConst this_val, int argc
 
 static JSValue rl_draw_cube(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
 
 	double width;
 
-	if (JS_ToFloat64(ctx, &width, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &width, argv[1]))
 		return JS_EXCEPTION;
 
 	double height;
 
-	if (JS_ToFloat64(ctx, &height, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &height, argv[2]))
 		return JS_EXCEPTION;
 
 	double length;
 
-	if (JS_ToFloat64(ctx, &length, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &length, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawCube(*position, width, height, length, *color);
 
@@ -2916,30 +3682,24 @@ static JSValue rl_draw_cube(JSContext* ctx, JSValueConst this_val, int argc, JSV
 
 static JSValue rl_draw_cube_wires(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
 
 	double width;
 
-	if (JS_ToFloat64(ctx, &width, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &width, argv[1]))
 		return JS_EXCEPTION;
 
 	double height;
 
-	if (JS_ToFloat64(ctx, &height, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &height, argv[2]))
 		return JS_EXCEPTION;
 
 	double length;
 
-	if (JS_ToFloat64(ctx, &length, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &length, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawCubeWires(*position, width, height, length, *color);
 
@@ -2948,20 +3708,11 @@ static JSValue rl_draw_cube_wires(JSContext* ctx, JSValueConst this_val, int arg
 
 static JSValue rl_draw_cube_v(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
 
-	Vector3* size = (Vector3*)JS_GetOpaque2(ctx, argv[1], js_rl_vector3_class_id);
+	JS_RL_ARG_POINTER(ctx, Vector3, size, argv[1], js_rl_vector3_class_id);
 
-	if (!size)
-		return JS_EXCEPTION;
-
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 
 	DrawCubeV(*position, *size, *color);
@@ -2971,20 +3722,11 @@ static JSValue rl_draw_cube_v(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_draw_cube_wires_v(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
-
-	Vector3* size = (Vector3*)JS_GetOpaque2(ctx, argv[1], js_rl_vector3_class_id);
-
-	if (!size)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
 
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_POINTER(ctx, Vector3, size, argv[1], js_rl_vector3_class_id);
 
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawCubeWiresV(*position, *size, *color);
 
@@ -2993,35 +3735,26 @@ static JSValue rl_draw_cube_wires_v(JSContext* ctx, JSValueConst this_val, int a
 
 static JSValue rl_draw_cube_texture(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Texture* texture = (Texture*)JS_GetOpaque2(ctx, argv[0], js_rl_texture2d_class_id);
-
-	if (!texture)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Texture, texture, argv[0], js_rl_texture2d_class_id);
 	
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[1], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[1], js_rl_vector3_class_id);
 
 	double width;
 
-	if (JS_ToFloat64(ctx, &width, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &width, argv[2]))
 		return JS_EXCEPTION;
 
 	double height;
 
-	if (JS_ToFloat64(ctx, &height, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
 	double length;
 
-	if (JS_ToFloat64(ctx, &length, argv[4]))
+	if (JS_RL_TO_FLOAT64(ctx, &length, argv[4]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[5], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[5], js_rl_color_class_id);
 
 	DrawCubeTexture(*texture, *position, width, height, length, *color);
 
@@ -3030,20 +3763,14 @@ static JSValue rl_draw_cube_texture(JSContext* ctx, JSValueConst this_val, int a
 
 static JSValue rl_draw_sphere(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* center = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!center)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, center, argv[0], js_rl_vector3_class_id);
 
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawSphere(*center, radius, *color);
 
@@ -3052,30 +3779,24 @@ static JSValue rl_draw_sphere(JSContext* ctx, JSValueConst this_val, int argc, J
 
 static JSValue rl_draw_sphere_ex(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* center = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!center)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, center, argv[0], js_rl_vector3_class_id);
 
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
 	int rings;
 
-	if (JS_ToInt32(ctx, &rings, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &rings, argv[2]))
 		return JS_EXCEPTION;
 
 	int slices;
 
-	if (JS_ToInt32(ctx, &slices, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &slices, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawSphereEx(*center, radius, rings, slices, *color);
 
@@ -3084,30 +3805,24 @@ static JSValue rl_draw_sphere_ex(JSContext* ctx, JSValueConst this_val, int argc
 
 static JSValue rl_draw_sphere_wires(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* center = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!center)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, center, argv[0], js_rl_vector3_class_id);
 
 	double radius;
 
-	if (JS_ToFloat64(ctx, &radius, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[1]))
 		return JS_EXCEPTION;
 
 	int rings;
 
-	if (JS_ToInt32(ctx, &rings, argv[2]))
+	if (JS_RL_TO_INT32(ctx, &rings, argv[2]))
 		return JS_EXCEPTION;
 
 	int slices;
 
-	if (JS_ToInt32(ctx, &slices, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &slices, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawSphereWires(*center, radius, rings, slices, *color);
 
@@ -3116,35 +3831,29 @@ static JSValue rl_draw_sphere_wires(JSContext* ctx, JSValueConst this_val, int a
 
 static JSValue rl_draw_cylinder(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
 
 	double radiusTop;
 
-	if (JS_ToFloat64(ctx, &radiusTop, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radiusTop, argv[1]))
 		return JS_EXCEPTION;
 
 	double radiusBottom;
 
-	if (JS_ToFloat64(ctx, &radiusBottom, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radiusBottom, argv[2]))
 		return JS_EXCEPTION;
 
 	double height;
 
-	if (JS_ToFloat64(ctx, &height, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
 	int slices;
 
-	if (JS_ToInt32(ctx, &slices, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &slices, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawCylinder(*position, radiusTop, radiusBottom, height, slices, *color);
 
@@ -3153,35 +3862,29 @@ static JSValue rl_draw_cylinder(JSContext* ctx, JSValueConst this_val, int argc,
 
 static JSValue rl_draw_cylinder_wires(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!position)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
 
 	double radiusTop;
 
-	if (JS_ToFloat64(ctx, &radiusTop, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &radiusTop, argv[1]))
 		return JS_EXCEPTION;
 
 	double radiusBottom;
 
-	if (JS_ToFloat64(ctx, &radiusBottom, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &radiusBottom, argv[2]))
 		return JS_EXCEPTION;
 
 	double height;
 
-	if (JS_ToFloat64(ctx, &height, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &height, argv[3]))
 		return JS_EXCEPTION;
 
 	int slices;
 
-	if (JS_ToInt32(ctx, &slices, argv[3]))
+	if (JS_RL_TO_INT32(ctx, &slices, argv[3]))
 		return JS_EXCEPTION;
 	
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[4], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[4], js_rl_color_class_id);
 
 	DrawCylinderWires(*position, radiusTop, radiusBottom, height, slices, *color);
 
@@ -3190,20 +3893,11 @@ static JSValue rl_draw_cylinder_wires(JSContext* ctx, JSValueConst this_val, int
 
 static JSValue rl_draw_plane(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* center = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-
-	if (!center)
-		return JS_EXCEPTION;
-
-	Vector2* size = (Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
-
-	if (!size)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Vector3, center, argv[0], js_rl_vector3_class_id);
 
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[2], js_rl_color_class_id);
+	JS_RL_ARG_POINTER(ctx, Vector2, size, argv[1], js_rl_vector2_class_id);
 
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[2], js_rl_color_class_id);
 
 	DrawPlane(*center, *size, *color);
 
@@ -3212,15 +3906,9 @@ static JSValue rl_draw_plane(JSContext* ctx, JSValueConst this_val, int argc, JS
 
 static JSValue rl_draw_ray(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Ray* ray = (Ray*)JS_GetOpaque2(ctx, argv[0], js_rl_ray_class_id);
-
-	if (!ray)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Ray, ray, argv[0], js_rl_ray_class_id);
 
-	Color* color = (Color*)JS_GetOpaque2(ctx, argv[1], js_rl_color_class_id);
-
-	if (!color)
-		return JS_EXCEPTION;
+	JS_RL_ARG_POINTER(ctx, Color, color, argv[1], js_rl_color_class_id);
 
 	DrawRay(*ray, *color);
 
@@ -3231,12 +3919,12 @@ static JSValue rl_draw_grid(JSContext* ctx, JSValueConst this_val, int argc, JSV
 {
 	int slices;
 
-	if (JS_ToInt32(ctx, &slices, argv[0]))
+	if (JS_RL_TO_INT32(ctx, &slices, argv[0]))
 		return JS_EXCEPTION;
 	
 	double spacing;
 
-	if (JS_ToFloat64(ctx, &spacing, argv[1]))
+	if (JS_RL_TO_FLOAT64(ctx, &spacing, argv[1]))
 		return JS_EXCEPTION;
 
 	DrawGrid(slices, spacing);
@@ -3246,16 +3934,185 @@ static JSValue rl_draw_grid(JSContext* ctx, JSValueConst this_val, int argc, JSV
 
 static JSValue rl_draw_gizmo(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
+	JS_RL_ARG_POINTER(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
+
+	DrawGizmo(*position);
+
+	return JS_UNDEFINED;
+}
+
+#pragma endregion
+#pragma region Model loading/unloading functions
+
+static JSValue rl_load_model(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (fileName == NULL)
+		return JS_EXCEPTION;
+
+	return js_rl_new_model(ctx, LoadModel(fileName));
+}
+
+#pragma endregion
+#pragma region Mesh generation functions
+
+static JSValue rl_gen_mesh_plane(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	double width, length;
+	int resX, resZ;
 
-	if (!position)
+	if (JS_RL_TO_FLOAT64(ctx, &width, argv[0]))
 		return JS_EXCEPTION;
 
-	DrawGizmo(*position);
+	if (JS_RL_TO_FLOAT64(ctx, &length, argv[1]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_INT32(ctx, &resX, argv[2]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_INT32(ctx, &resZ, argv[3]))
+		return JS_EXCEPTION;
+
+	return js_rl_new_mesh(ctx, GenMeshPlane(width, length, resX, resZ));
+}
+
+static JSValue rl_gen_mesh_cube(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	double width, height, length;
+
+	if (JS_RL_TO_FLOAT64(ctx, &width, argv[0]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_FLOAT64(ctx, &height, argv[1]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_FLOAT64(ctx, &length, argv[2]))
+		return JS_EXCEPTION;
+
+	return js_rl_new_mesh(ctx, GenMeshCube(width, height, length));
+}
+
+static JSValue rl_gen_mesh_sphere(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	double radius;
+	int rings, slices;
+
+	if (JS_RL_TO_FLOAT64(ctx, &radius, argv[0]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_INT32(ctx, &rings, argv[1]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_INT32(ctx, &slices, argv[2]))
+		return JS_EXCEPTION;
+
+	return js_rl_new_mesh(ctx, GenMeshSphere(radius, rings, slices));
+}
+
+#pragma endregion
+#pragma region Shader loading/unloading functions
+
+static JSValue rl_load_shader(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	// Either file may be left out to use the default shader for that stage.
+	// Both are converted without the string cache, see isFileExtension().
+	const char* vsFileName = NULL;
+	const char* fsFileName = NULL;
+
+	if (!JS_IsUndefined(argv[0]) && !JS_IsNull(argv[0]) && !(vsFileName = JS_ToCString(ctx, argv[0])))
+		return JS_EXCEPTION;
+
+	if (!JS_IsUndefined(argv[1]) && !JS_IsNull(argv[1]) && !(fsFileName = JS_ToCString(ctx, argv[1])))
+	{
+		JS_FreeCString(ctx, vsFileName);
+		return JS_EXCEPTION;
+	}
+
+	Shader shader = LoadShader(vsFileName, fsFileName);
+
+	JS_FreeCString(ctx, vsFileName);
+	JS_FreeCString(ctx, fsFileName);
+
+	// raylib falls back to its default shader, which the Shader finalizer
+	// would then unload
+	if (shader.id == GetShaderDefault().id)
+		return JS_ThrowInternalError(ctx, "could not load shader");
+
+	return js_rl_new_shader(ctx, shader);
+}
+
+#pragma endregion
+#pragma region Audio device management functions
+
+static JSValue rl_init_audio_device(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	InitAudioDevice();
 
 	return JS_UNDEFINED;
 }
 
+static JSValue rl_close_audio_device(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	CloseAudioDevice();
+
+	return JS_UNDEFINED;
+}
+
+static JSValue rl_is_audio_device_ready(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	return JS_NewBool(ctx, IsAudioDeviceReady());
+}
+
+#pragma endregion
+#pragma region Wave/Sound loading/unloading functions
+
+static JSValue rl_load_wave(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (fileName == NULL)
+		return JS_EXCEPTION;
+
+	return js_rl_new_wave(ctx, LoadWave(fileName));
+}
+
+static JSValue rl_load_sound(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	const char* fileName = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (fileName == NULL)
+		return JS_EXCEPTION;
+
+	return js_rl_new_sound(ctx, LoadSound(fileName));
+}
+
+static JSValue rl_load_sound_from_wave(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JS_RL_ARG_VALUE(ctx, Wave, wave, argv[0], js_rl_wave_class_id);
+
+	return js_rl_new_sound(ctx, LoadSoundFromWave(wave));
+}
+
+#pragma endregion
+#pragma region AudioStream management functions
+
+static JSValue rl_init_audio_stream(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t sampleRate, sampleSize, channels;
+
+	if (JS_RL_TO_UINT32(ctx, &sampleRate, argv[0]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_UINT32(ctx, &sampleSize, argv[1]))
+		return JS_EXCEPTION;
+
+	if (JS_RL_TO_UINT32(ctx, &channels, argv[2]))
+		return JS_EXCEPTION;
+
+	return js_rl_new_audio_stream(ctx, InitAudioStream(sampleRate, sampleSize, channels));
+}
+
 #pragma endregion
 
 // function entries
@@ -3327,6 +4184,12 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("getFrameTime", 0, rl_get_frame_time),
 	JS_CFUNC_DEF("getTime", 0, rl_get_time),
 
+	#pragma endregion
+	#pragma region Main loop functions
+
+	JS_CFUNC_DEF("runMainLoop", 1, rl_run_main_loop),
+	JS_CFUNC_DEF("stopMainLoop", 0, rl_stop_main_loop),
+
 	#pragma endregion
 	#pragma region Color-related functions
 
@@ -3415,6 +4278,19 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("getTouchY", 0, rl_get_touch_y),
 	JS_CFUNC_DEF("getTouchPosition", 1, rl_get_touch_position),
 
+	#pragma endregion
+	#pragma region Input-related functions: snapshot
+
+	JS_CFUNC_DEF("pollInput", 1, js_rl_poll_input),
+	JS_CFUNC_DEF("setInputEvents", 1, js_rl_set_input_events),
+	JS_CFUNC_DEF("drainInputEvents", 1, js_rl_drain_input_events),
+	JS_CFUNC_DEF("getInputEventStats", 0, js_rl_get_input_event_stats),
+	JS_CFUNC_DEF("startInputRecording", 2, js_rl_start_input_recording),
+	JS_CFUNC_DEF("stopInputRecording", 0, js_rl_stop_input_recording),
+	JS_CFUNC_DEF("startInputReplay", 1, js_rl_start_input_replay),
+	JS_CFUNC_DEF("stopInputReplay", 0, js_rl_stop_input_replay),
+	JS_CFUNC_DEF("getInputRecordingState", 0, js_rl_get_input_recording_state),
+
 	#pragma endregion
 	#pragma region Gestures and Touch Handling Functions
 
@@ -3450,6 +4326,7 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("drawLineEx", 4, rl_draw_line_ex),
 	JS_CFUNC_DEF("drawLineBezier", 4, rl_draw_line_bezier),
 	JS_CFUNC_DEF("drawLineStrip", 2, rl_draw_line_strip),
+	JS_CFUNC_DEF("drawPolyline", 5, rl_draw_polyline),
 
 	JS_CFUNC_DEF("drawCircle", 4, rl_draw_circle),
 	JS_CFUNC_DEF("drawCircleLines", 4, rl_draw_circle_lines),
@@ -3473,9 +4350,17 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("drawTriangle", 4, rl_draw_triangle),
 	JS_CFUNC_DEF("drawTriangleLines", 4, rl_draw_triangle_lines),
 	JS_CFUNC_DEF("drawTriangleFan", 2, rl_draw_triangle_fan),
+	JS_CFUNC_DEF("drawTriangleStrip", 2, rl_draw_triangle_strip),
 	JS_CFUNC_DEF("drawPoly", 5, rl_draw_poly),
 	JS_CFUNC_DEF("setShapesTexture", 2, rl_set_shapes_texture),
 
+	#pragma endregion
+	#pragma region Batched shapes drawing functions
+
+	JS_CFUNC_DEF("drawRectangles", 2, rl_draw_rectangles),
+	JS_CFUNC_DEF("drawCircles", 2, rl_draw_circles),
+	JS_CFUNC_DEF("drawPixels", 2, rl_draw_pixels),
+
 	#pragma endregion
 	#pragma region Basic shapes collision detection functions
 
@@ -3487,6 +4372,11 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("checkCollisionPointCircle", 2, rl_check_collision_point_circle),
 	JS_CFUNC_DEF("checkCollisionPointTriangle", 4, rl_check_collision_point_triangle),
 
+	#pragma endregion
+	#pragma region Draw list functions
+
+	JS_CFUNC_DEF("submitDrawList", 3, js_rl_submit_draw_list),
+
 	#pragma endregion
 
 	// module: textures
@@ -3507,10 +4397,13 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("unloadRenderTexture", 1, rl_unload_render_texture),
 	JS_CFUNC_DEF("getImageData", 1, rl_get_image_data),
 	JS_CFUNC_DEF("getImageDataNormalized", 1, rl_get_image_data_normalized),
+	JS_CFUNC_DEF("getImageDataBuffer", 1, rl_get_image_data_buffer),
+	JS_CFUNC_DEF("getImageDataNormalizedBuffer", 1, rl_get_image_data_normalized_buffer),
 	JS_CFUNC_DEF("getPixelDataSize", 3, rl_get_pixel_data_size),
 	JS_CFUNC_DEF("getTextureData", 1, rl_get_texture_data),
 	JS_CFUNC_DEF("getScreenData", 0, rl_get_screen_data),
-	JS_CFUNC_DEF("updateTexture", 1, rl_update_texture),
+	JS_CFUNC_DEF("updateTexture", 2, rl_update_texture),
+	JS_CFUNC_DEF("updateTextureRec", 3, rl_update_texture_rec),
 
 	#pragma endregion
 	#pragma region Image manipulation functions
@@ -3530,7 +4423,7 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	#pragma endregion
 	#pragma region Texture2D drawing functions
 
-	
+	JS_CFUNC_DEF("drawTextureBatch", 3, rl_draw_texture_batch),
 
 	#pragma endregion
 
@@ -3560,6 +4453,8 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	JS_CFUNC_DEF("measureText", 2, rl_measure_text),
 	JS_CFUNC_DEF("measureTextEx", 4, rl_measure_text_ex),
 	JS_CFUNC_DEF("getGlyphIndex", 2, rl_get_glyph_index),
+	JS_CFUNC_DEF("measureTextBatch", 4, rl_measure_text_batch),
+	JS_CFUNC_DEF("breakTextLines", 5, rl_break_text_lines),
 
 	#pragma endregion
 	#pragma region Text strings management functions
@@ -3592,7 +4487,7 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	#pragma endregion
 	#pragma region Model loading/unloading functions
 
-
+	JS_CFUNC_DEF("loadModel", 1, rl_load_model),
 
 	#pragma endregion
 	#pragma region Mesh loading/unloading functions
@@ -3612,7 +4507,9 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	#pragma endregion
 	#pragma region Mesh generation functions
 
-
+	JS_CFUNC_DEF("genMeshPlane", 4, rl_gen_mesh_plane),
+	JS_CFUNC_DEF("genMeshCube", 3, rl_gen_mesh_cube),
+	JS_CFUNC_DEF("genMeshSphere", 3, rl_gen_mesh_sphere),
 
 	#pragma endregion
 	#pragma region Mesh manipulation functions
@@ -3634,7 +4531,7 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	// module: shaders
 	#pragma region Shader loading/unloading functions
 
-
+	JS_CFUNC_DEF("loadShader", 2, rl_load_shader),
 
 	#pragma endregion
 	#pragma region Shader configuration functions
@@ -3656,12 +4553,16 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	// module: audio
 	#pragma region Audio device management functions
 
-
+	JS_CFUNC_DEF("initAudioDevice", 0, rl_init_audio_device),
+	JS_CFUNC_DEF("closeAudioDevice", 0, rl_close_audio_device),
+	JS_CFUNC_DEF("isAudioDeviceReady", 0, rl_is_audio_device_ready),
 
 	#pragma endregion
 	#pragma region Wave/Sound loading/unloading functions
 
-
+	JS_CFUNC_DEF("loadWave", 1, rl_load_wave),
+	JS_CFUNC_DEF("loadSound", 1, rl_load_sound),
+	JS_CFUNC_DEF("loadSoundFromWave", 1, rl_load_sound_from_wave),
 
 	#pragma endregion
 	#pragma region Wave/Sound management functions
@@ -3676,7 +4577,52 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 	#pragma endregion
 	#pragma region AudioStream management functions
 
+	JS_CFUNC_DEF("initAudioStream", 3, rl_init_audio_stream),
+
+	#pragma endregion
+
+	// module: runtime
+	#pragma region Memory management functions
+
+	JS_CFUNC_DEF("getPoolStats", 0, js_rl_get_pool_stats),
+	JS_CFUNC_DEF("trimPools", 0, js_rl_trim_pools),
+	JS_CFUNC_DEF("setFrameArena", 1, js_rl_set_frame_arena),
+	JS_CFUNC_DEF("getFrameArenaStats", 0, js_rl_get_frame_arena_stats),
+	JS_CFUNC_DEF("persist", 1, js_rl_persist),
+	JS_CFUNC_DEF("getStringCacheStats", 0, js_rl_get_string_cache_stats),
+	JS_CFUNC_DEF("setTextLayoutCacheSize", 1, js_rl_set_text_layout_cache_size),
+	JS_CFUNC_DEF("getTextLayoutCacheStats", 0, js_rl_get_text_layout_cache_stats),
+
+	#pragma endregion
+	#pragma region Frame profiler functions
+
+	JS_CFUNC_DEF("setFrameProfiler", 2, js_rl_set_frame_profiler),
+	JS_CFUNC_DEF("getFrameProfile", 0, js_rl_get_frame_profile),
+	JS_CFUNC_DEF("getFrameProfileStats", 0, js_rl_get_frame_profile_stats),
+	JS_CFUNC_DEF("drawFrameProfile", 5, js_rl_draw_frame_profile),
+
+	#pragma endregion
+	#pragma region Tracing functions
+
+	JS_CFUNC_DEF("startTrace", 1, js_rl_start_trace),
+	JS_CFUNC_DEF("stopTrace", 0, js_rl_stop_trace),
+	JS_CFUNC_DEF("traceBegin", 1, js_rl_begin_trace_span),
+	JS_CFUNC_DEF("traceEnd", 0, js_rl_end_trace_span),
+	JS_CFUNC_DEF("traceInstant", 1, js_rl_add_trace_instant),
+	JS_CFUNC_DEF("getTraceStats", 0, js_rl_get_trace_stats),
+
+	#pragma endregion
+	#pragma region Binding instrumentation functions
+
+	JS_CFUNC_DEF("getBindingNames", 0, js_rl_get_binding_names),
+	JS_CFUNC_DEF("getBindingStats", 1, js_rl_get_binding_stats),
+
+	#pragma endregion
+	#pragma region Garbage collection functions
 
+	JS_CFUNC_DEF("setIdleGc", 2, js_rl_set_idle_gc),
+	JS_CFUNC_DEF("setGcThreshold", 1, js_rl_set_gc_threshold),
+	JS_CFUNC_DEF("getHeapStats", 0, js_rl_get_heap_stats),
 
 	#pragma endregion
 };
@@ -3686,8 +4632,9 @@ static const JSCFunctionListEntry js_rl_funcs[] = {
 static int js_rl_init(JSContext* ctx, JSModuleDef* m)
 {
 	js_rl_init_classes(ctx, m);
+	js_rl_init_runtime_sentinel(ctx, m);
 
-	return JS_SetModuleExportList(ctx, m, js_rl_funcs, countof(js_rl_funcs));
+	return js_rl_set_module_export_list(ctx, m, js_rl_funcs, countof(js_rl_funcs));
 }
 
 JSModuleDef* js_init_module(JSContext* ctx, const char* module_name)
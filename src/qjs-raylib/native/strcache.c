@@ -0,0 +1,261 @@
+#include "pthread.h"
+#include "stdatomic.h"
+
+#include "strcache.h"
+
+#pragma region String cache
+
+typedef struct JSRLStringEntry
+{
+	// Keeping a reference on the string guarantees its address can't be
+	// reused by another string while it serves as the key
+	JSValue str;
+	const char* utf8;
+	size_t len;
+	uint64_t stamp;
+	int64_t frame;
+} JSRLStringEntry;
+
+typedef struct JSRLStringCache
+{
+	JSRuntime* rt;
+	JSRLStringEntry entries[JS_RL_STRING_CACHE_SETS][JS_RL_STRING_CACHE_WAYS];
+	uint32_t count;
+	uint64_t stamp;
+	int64_t frame;
+	int64_t hits;
+	int64_t misses;
+	int64_t evictions;
+	int64_t expired;
+	struct JSRLStringCache* next;
+} JSRLStringCache;
+
+// Caches are looked up by runtime like the object pools: the last hit is
+// remembered per thread and only trusted while no cache was freed since
+static JSRLStringCache* js_rl_string_caches = NULL;
+static _Atomic uint64_t js_rl_string_caches_epoch = 0;
+static __thread JSRLStringCache* js_rl_string_caches_last = NULL;
+static __thread uint64_t js_rl_string_caches_last_epoch = 0;
+static pthread_mutex_t js_rl_string_caches_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static JSRLStringCache* js_rl_get_string_cache(JSRuntime* rt)
+{
+	JSRLStringCache* c = js_rl_string_caches_last;
+
+	if (c && js_rl_string_caches_last_epoch == atomic_load(&js_rl_string_caches_epoch) && c->rt == rt)
+		return c;
+
+	pthread_mutex_lock(&js_rl_string_caches_mutex);
+
+	uint64_t epoch = atomic_load(&js_rl_string_caches_epoch);
+
+	for (c = js_rl_string_caches; c; c = c->next)
+	{
+		if (c->rt == rt)
+			break;
+	}
+
+	if (!c)
+	{
+		c = calloc(1, sizeof(JSRLStringCache));
+
+		if (c)
+		{
+			c->rt = rt;
+			c->next = js_rl_string_caches;
+			js_rl_string_caches = c;
+		}
+	}
+
+	pthread_mutex_unlock(&js_rl_string_caches_mutex);
+
+	js_rl_string_caches_last = c;
+	js_rl_string_caches_last_epoch = epoch;
+
+	return c;
+}
+
+static uint32_t js_rl_string_cache_set(void* p)
+{
+	uint64_t h = ((uintptr_t)p >> 3) * 0x9E3779B97F4A7C15ull;
+	return (uint32_t)(h >> 32) & (JS_RL_STRING_CACHE_SETS - 1);
+}
+
+static void js_rl_string_entry_free(JSContext* ctx, JSRLStringCache* cache, JSRLStringEntry* e)
+{
+	JS_FreeCString(ctx, e->utf8);
+	JS_FreeValue(ctx, e->str);
+	memset(e, 0, sizeof(JSRLStringEntry));
+	cache->count--;
+}
+
+const char* js_rl_get_cached_string_len(JSContext* ctx, JSValueConst val, size_t* len)
+{
+	JSRLStringCache* cache = js_rl_get_string_cache(JS_GetRuntime(ctx));
+
+	if (!cache)
+	{
+		JS_ThrowOutOfMemory(ctx);
+		return NULL;
+	}
+
+	JSValue str = JS_IsString(val) ? JS_DupValue(ctx, val) : JS_ToString(ctx, val);
+
+	if (JS_IsException(str))
+		return NULL;
+
+	void* key = JS_VALUE_GET_PTR(str);
+	JSRLStringEntry* set = cache->entries[js_rl_string_cache_set(key)];
+	JSRLStringEntry* victim = &set[0];
+
+	for (int i = 0; i < JS_RL_STRING_CACHE_WAYS; i++)
+	{
+		JSRLStringEntry* e = &set[i];
+
+		if (e->utf8 && JS_VALUE_GET_PTR(e->str) == key)
+		{
+			JS_FreeValue(ctx, str);
+			e->stamp = ++cache->stamp;
+			e->frame = cache->frame;
+			cache->hits++;
+
+			if (len)
+				*len = e->len;
+
+			return e->utf8;
+		}
+
+		if (victim->utf8 && (!e->utf8 || e->stamp < victim->stamp))
+			victim = e;
+	}
+
+	size_t size;
+	const char* utf8 = JS_ToCStringLen(ctx, &size, str);
+
+	if (!utf8)
+	{
+		JS_FreeValue(ctx, str);
+		return NULL;
+	}
+
+	if (victim->utf8)
+	{
+		js_rl_string_entry_free(ctx, cache, victim);
+		cache->evictions++;
+	}
+
+	victim->str = str;
+	victim->utf8 = utf8;
+	victim->len = size;
+	victim->stamp = ++cache->stamp;
+	victim->frame = cache->frame;
+	cache->count++;
+	cache->misses++;
+
+	if (len)
+		*len = size;
+
+	return utf8;
+}
+
+const char* js_rl_get_cached_string(JSContext* ctx, JSValueConst val)
+{
+	return js_rl_get_cached_string_len(ctx, val, NULL);
+}
+
+void js_rl_string_cache_sweep(JSContext* ctx)
+{
+	JSRLStringCache* cache = js_rl_get_string_cache(JS_GetRuntime(ctx));
+
+	if (!cache)
+		return;
+
+	cache->frame++;
+
+	for (int s = 0; s < JS_RL_STRING_CACHE_SETS; s++)
+	{
+		for (int i = 0; i < JS_RL_STRING_CACHE_WAYS; i++)
+		{
+			JSRLStringEntry* e = &cache->entries[s][i];
+
+			if (e->utf8 && cache->frame - e->frame > JS_RL_STRING_CACHE_MAX_AGE)
+			{
+				js_rl_string_entry_free(ctx, cache, e);
+				cache->expired++;
+			}
+		}
+	}
+}
+
+static void js_rl_string_cache_free_entries(JSContext* ctx, JSRLStringCache* cache)
+{
+	for (int s = 0; s < JS_RL_STRING_CACHE_SETS; s++)
+	{
+		for (int i = 0; i < JS_RL_STRING_CACHE_WAYS; i++)
+		{
+			if (cache->entries[s][i].utf8)
+				js_rl_string_entry_free(ctx, cache, &cache->entries[s][i]);
+		}
+	}
+}
+
+void js_rl_string_cache_clear(JSContext* ctx)
+{
+	JSRLStringCache* cache = js_rl_get_string_cache(JS_GetRuntime(ctx));
+
+	if (cache)
+		js_rl_string_cache_free_entries(ctx, cache);
+}
+
+void js_rl_string_cache_release(JSContext* ctx)
+{
+	JSRuntime* rt = JS_GetRuntime(ctx);
+	JSRLStringCache* cache = NULL;
+
+	pthread_mutex_lock(&js_rl_string_caches_mutex);
+
+	for (JSRLStringCache** link = &js_rl_string_caches; *link; link = &(*link)->next)
+	{
+		if ((*link)->rt == rt)
+		{
+			cache = *link;
+			*link = cache->next;
+			atomic_fetch_add(&js_rl_string_caches_epoch, 1);
+			break;
+		}
+	}
+
+	pthread_mutex_unlock(&js_rl_string_caches_mutex);
+
+	if (!cache)
+		return;
+
+	js_rl_string_cache_free_entries(ctx, cache);
+	free(cache);
+}
+
+JSValue js_rl_get_string_cache_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	JSRLStringCache* cache = js_rl_get_string_cache(JS_GetRuntime(ctx));
+
+	if (!cache)
+		return JS_ThrowOutOfMemory(ctx);
+
+	int64_t lookups = cache->hits + cache->misses;
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "entries", JS_NewUint32(ctx, cache->count));
+	JS_SetPropertyStr(ctx, obj, "capacity", JS_NewUint32(ctx, JS_RL_STRING_CACHE_SETS * JS_RL_STRING_CACHE_WAYS));
+	JS_SetPropertyStr(ctx, obj, "hits", JS_NewInt64(ctx, cache->hits));
+	JS_SetPropertyStr(ctx, obj, "misses", JS_NewInt64(ctx, cache->misses));
+	JS_SetPropertyStr(ctx, obj, "evictions", JS_NewInt64(ctx, cache->evictions));
+	JS_SetPropertyStr(ctx, obj, "expired", JS_NewInt64(ctx, cache->expired));
+	JS_SetPropertyStr(ctx, obj, "hitRate", JS_NewFloat64(ctx, lookups ? (double)cache->hits / lookups : 0));
+
+	return obj;
+}
+
+#pragma endregion
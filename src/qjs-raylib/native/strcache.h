@@ -0,0 +1,34 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+
+#pragma region String cache
+
+// The cache is set associative: a string can only live in one set, and the
+// least recently used way of that set is evicted to make room
+#define JS_RL_STRING_CACHE_SETS 128
+#define JS_RL_STRING_CACHE_WAYS 4
+// Entries not looked up for this many frames are dropped by the sweep
+#define JS_RL_STRING_CACHE_MAX_AGE 120
+
+// Returns the UTF-8 encoding of val, converting it to a string first if
+// needed. The buffer is owned by the cache: never free it, and don't keep it
+// past the current binding call. It stays valid for at least
+// JS_RL_STRING_CACHE_WAYS - 1 further lookups, so a binding may fetch up to
+// JS_RL_STRING_CACHE_WAYS strings at once. Any conversion that may run JS
+// code (valueOf, toString, getters) can make lookups of its own: fetch the
+// string after the binding's other arguments and never convert a second
+// non-string value while holding one.
+const char* js_rl_get_cached_string(JSContext* ctx, JSValueConst val);
+const char* js_rl_get_cached_string_len(JSContext* ctx, JSValueConst val, size_t* len);
+
+void js_rl_string_cache_sweep(JSContext* ctx);
+void js_rl_string_cache_clear(JSContext* ctx);
+// Frees the cache of the runtime of ctx, once the runtime is going away
+void js_rl_string_cache_release(JSContext* ctx);
+
+JSValue js_rl_get_string_cache_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
@@ -1,674 +1,605 @@
 #include "structs.h"
-
-#pragma region Image
-
-void js_rl_image_finalizer(JSRuntime* rt, JSValue val)
-{
-	Image* p = (Image*)JS_GetOpaque(val, js_rl_image_class_id);
-	UnloadImage(*p);
-}
-
-JSClassDef js_rl_image_class =
-{
-	"Image",
-	.finalizer = js_rl_image_finalizer,
+#include "drawlist.h"
+#include "textcache.h"
+#include "args.h"
+
+#pragma region Struct fields
+
+// Classes whose fields are described by the tables below
+typedef enum JSRLStructClass
+{
+	JS_RL_STRUCT_IMAGE,
+	JS_RL_STRUCT_VECTOR2,
+	JS_RL_STRUCT_VECTOR3,
+	JS_RL_STRUCT_VECTOR4,
+	JS_RL_STRUCT_CAMERA2D,
+	JS_RL_STRUCT_CAMERA3D,
+	JS_RL_STRUCT_TEXTURE2D,
+	JS_RL_STRUCT_RENDER_TEXTURE,
+	JS_RL_STRUCT_RAY,
+	JS_RL_STRUCT_COLOR,
+	JS_RL_STRUCT_MATRIX,
+	JS_RL_STRUCT_RECTANGLE,
+	JS_RL_STRUCT_FONT,
+	JS_RL_STRUCT_CHAR_INFO,
+	JS_RL_STRUCT_SHADER,
+	JS_RL_STRUCT_MESH,
+	JS_RL_STRUCT_MODEL,
+	JS_RL_STRUCT_WAVE,
+	JS_RL_STRUCT_SOUND,
+	JS_RL_STRUCT_AUDIO_STREAM,
+	JS_RL_STRUCT_COUNT,
+} JSRLStructClass;
+
+typedef struct JSRLStructClassDef
+{
+	JSClassID* class_id;
+	JSClassDef* class_def;
+	const JSCFunctionListEntry* fields;
+	int field_count;
+	// Exported under the class name when set
+	JSCFunction* constructor;
+	int length;
+} JSRLStructClassDef;
+
+// Defined at the end of the file, after the field tables
+static const JSRLStructClassDef js_rl_struct_classes[JS_RL_STRUCT_COUNT];
+
+// Pooled struct classes. `element_size` is the size of the struct fields when
+// written to a typed array, 0 for structs that mix field types.
+static const struct { JSClassID* class_id; JSRLPoolKind kind; size_t size; size_t element_size; } js_rl_pooled_classes[] =
+{
+	[JS_RL_POOL_VECTOR2] = { &js_rl_vector2_class_id, JS_RL_POOL_VECTOR2, sizeof(Vector2), sizeof(float) },
+	[JS_RL_POOL_VECTOR3] = { &js_rl_vector3_class_id, JS_RL_POOL_VECTOR3, sizeof(Vector3), sizeof(float) },
+	[JS_RL_POOL_VECTOR4] = { &js_rl_vector4_class_id, JS_RL_POOL_VECTOR4, sizeof(Vector4), sizeof(float) },
+	[JS_RL_POOL_COLOR] = { &js_rl_color_class_id, JS_RL_POOL_COLOR, sizeof(Color), sizeof(unsigned char) },
+	[JS_RL_POOL_RECTANGLE] = { &js_rl_rectangle_class_id, JS_RL_POOL_RECTANGLE, sizeof(Rectangle), sizeof(float) },
+	[JS_RL_POOL_MATRIX] = { &js_rl_matrix_class_id, JS_RL_POOL_MATRIX, sizeof(Matrix), sizeof(float) },
+	[JS_RL_POOL_CAMERA2D] = { &js_rl_camera2d_class_id, JS_RL_POOL_CAMERA2D, sizeof(Camera2D), sizeof(float) },
+	[JS_RL_POOL_CAMERA3D] = { &js_rl_camera3d_class_id, JS_RL_POOL_CAMERA3D, sizeof(Camera3D), 0 },
+	[JS_RL_POOL_RAY] = { &js_rl_ray_class_id, JS_RL_POOL_RAY, sizeof(Ray), sizeof(float) },
 };
 
-JSValue js_rl_image_get_width(JSContext* ctx, JSValueConst this_val)
-{
-	Image* p = (Image*)JS_GetOpaque2(ctx, this_val, js_rl_image_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->width);
-	else
-		return JS_EXCEPTION;
-}
-
-JSValue js_rl_image_get_height(JSContext* ctx, JSValueConst this_val)
-{
-	Image* p = (Image*)JS_GetOpaque2(ctx, this_val, js_rl_image_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->height);
-	else
-		return JS_EXCEPTION;
-}
+// The magic of every accessor holds the field offset in its low byte and the
+// JSRLStructClass of the object above it, which limits fields to the first
+// 256 bytes of a struct
+#define JS_RL_FIELD_MAGIC(cls, offset) ((int)(offset) | ((cls) << 8))
 
-JSValue js_rl_image_get_format(JSContext* ctx, JSValueConst this_val)
-{
-	Image* p = (Image*)JS_GetOpaque2(ctx, this_val, js_rl_image_class_id);
+// The magic is an int16_t, which leaves 7 bits for the class
+_Static_assert(JS_RL_STRUCT_COUNT <= 128, "too many struct classes for the field magic");
 
-	if (p)
-		return JS_NewInt32(ctx, p->format);
-	else
-		return JS_EXCEPTION;
-}
+// offsetof(struct_type, field), failing the build when it doesn't fit the low
+// byte of the magic
+#define JS_RL_FIELD_OFFSET(struct_type, field) \
+	(offsetof(struct_type, field) + 0 * sizeof(struct { \
+		_Static_assert(offsetof(struct_type, field) < 256, #struct_type "." #field " is past the field magic offset range"); \
+		char unused; \
+	}))
 
-JSValue js_rl_image_get_mipmaps(JSContext* ctx, JSValueConst this_val)
-{
-	Image* p = (Image*)JS_GetOpaque2(ctx, this_val, js_rl_image_class_id);
+// `type` picks the accessors: float, int, uchar and bool fields and nested
+// vector2, vector3 and matrix structs (copied in and out) are read and
+// written, uint fields and the texture and image views are read only
+#define JS_RL_FIELD(name, type, cls, struct_type, field) \
+	JS_CGETSET_MAGIC_DEF(name, js_rl_get_##type##_field, js_rl_set_##type##_field, JS_RL_FIELD_MAGIC(cls, JS_RL_FIELD_OFFSET(struct_type, field)))
 
-	if (p)
-		return JS_NewInt32(ctx, p->mipmaps);
-	else
-		return JS_EXCEPTION;
-}
+#define JS_RL_READONLY_FIELD(name, type, cls, struct_type, field) \
+	JS_CGETSET_MAGIC_DEF(name, js_rl_get_##type##_field, NULL, JS_RL_FIELD_MAGIC(cls, JS_RL_FIELD_OFFSET(struct_type, field)))
 
-const JSCFunctionListEntry js_rl_image_proto_funcs[] =
+static inline uint8_t* js_rl_get_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	JS_CGETSET_DEF("width", js_rl_image_get_width, NULL),
-	JS_CGETSET_DEF("height", js_rl_image_get_height, NULL),
-	JS_CGETSET_DEF("format", js_rl_image_get_format, NULL),
-	JS_CGETSET_DEF("mipmaps", js_rl_image_get_mipmaps, NULL),
-};
+	uint8_t* p = (uint8_t*)JS_GetOpaque2(ctx, this_val, *js_rl_struct_classes[magic >> 8].class_id);
 
-void js_rl_init_image_class(JSContext* ctx, JSModuleDef* m)
-{
-	JSValue proto;
-	JS_NewClassID(&js_rl_image_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_image_class_id, &js_rl_image_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_image_proto_funcs, countof(js_rl_image_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_image_class_id, proto);
-	// JS_NewCFunction2(ctx, js_rl_image_constructor, "Image", 1, JS_CFUNC_constructor_or_func, 0);
+	return p ? p + (magic & 0xff) : NULL;
 }
 
-#pragma endregion
-#pragma region Vector2
-
-JSClassDef js_rl_vector2_class = { "Vector2" };
-
-JSValue js_rl_vector2_get_x(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_float_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Vector2* p = (Vector2*)JS_GetOpaque2(ctx, this_val, js_rl_vector2_class_id);
+	float* field = (float*)js_rl_get_field(ctx, this_val, magic);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->x);
-	else
+	if (!field)
 		return JS_EXCEPTION;
+
+	return JS_NewFloat64(ctx, *field);
 }
 
-JSValue js_rl_vector2_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_set_float_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	Vector2* p = (Vector2*)JS_GetOpaque2(ctx, this_val, js_rl_vector2_class_id);
+	float* field = (float*)js_rl_get_field(ctx, this_val, magic);
+	double value;
 
-	if (!p)
+	if (!field)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
+	// Assigning null leaves any field unchanged
 	if (JS_IsNull(v))
 		return JS_UNDEFINED;
 
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
+	if (JS_RL_TO_FLOAT64(ctx, &value, v))
 		return JS_EXCEPTION;
 
-	p->x = value;
+	*field = value;
 
 	return JS_UNDEFINED;
 }
 
-JSValue js_rl_vector2_get_y(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_int_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Vector2* p = (Vector2*)JS_GetOpaque2(ctx, this_val, js_rl_vector2_class_id);
+	int* field = (int*)js_rl_get_field(ctx, this_val, magic);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->y);
-	else
+	if (!field)
 		return JS_EXCEPTION;
+
+	return JS_NewInt32(ctx, *field);
 }
 
-JSValue js_rl_vector2_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_set_int_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	Vector2* p = (Vector2*)JS_GetOpaque2(ctx, this_val, js_rl_vector2_class_id);
+	int* field = (int*)js_rl_get_field(ctx, this_val, magic);
+	int value;
 
-	if (!p)
+	if (!field)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
 	if (JS_IsNull(v))
 		return JS_UNDEFINED;
 
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
+	if (JS_RL_TO_INT32(ctx, &value, v))
 		return JS_EXCEPTION;
 
-	p->y = value;
+	*field = value;
 
 	return JS_UNDEFINED;
 }
 
-JSValue js_rl_new_vector2(JSContext* ctx, double x, double y)
-{
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
-	Vector2* p = js_mallocz(ctx, sizeof(Vector2));
-
-	p->x = x;
-	p->y = y;
-
-	JS_SetOpaque(obj, p);
-
-	return obj;
-}
-
-JSValue js_rl_vector2_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+static JSValue js_rl_get_uint_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	double x, y;
+	unsigned int* field = (unsigned int*)js_rl_get_field(ctx, this_val, magic);
 
-	if (JS_ToFloat64(ctx, &x, argv[0]))
+	if (!field)
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &y, argv[1]))
-		return JS_EXCEPTION;
-
-	return js_rl_new_vector2(ctx, x, y);
-}
-
-const JSCFunctionListEntry js_rl_vector2_proto_funcs[] =
-{
-	JS_CGETSET_DEF("x", js_rl_vector2_get_x, js_rl_vector2_set_x),
-	JS_CGETSET_DEF("y", js_rl_vector2_get_y, js_rl_vector2_set_y),
-};
-
-void js_rl_init_vector2_class(JSContext* ctx, JSModuleDef* m)
-{
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_vector2_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_vector2_class_id, &js_rl_vector2_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_vector2_proto_funcs, countof(js_rl_vector2_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_vector2_class_id, proto);
-
-	obj = JS_NewCFunction2(ctx, js_rl_vector2_constructor, "Vector2", 2, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Vector2", obj);
+	return JS_NewUint32(ctx, *field);
 }
 
-#pragma endregion
-#pragma region Vector3
-
-JSClassDef js_rl_vector3_class = { "Vector3" };
-
-JSValue js_rl_vector3_get_x(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_uchar_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Vector3* p = (Vector3*)JS_GetOpaque2(ctx, this_val, js_rl_vector3_class_id);
+	unsigned char* field = js_rl_get_field(ctx, this_val, magic);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->x);
-	else
+	if (!field)
 		return JS_EXCEPTION;
+
+	return JS_NewInt32(ctx, *field);
 }
 
-JSValue js_rl_vector3_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_set_uchar_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	Vector3* p = (Vector3*)JS_GetOpaque2(ctx, this_val, js_rl_vector3_class_id);
+	unsigned char* field = js_rl_get_field(ctx, this_val, magic);
+	int value;
 
-	if (!p)
+	if (!field)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
 	if (JS_IsNull(v))
 		return JS_UNDEFINED;
 
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
+	if (JS_RL_TO_INT32(ctx, &value, v))
 		return JS_EXCEPTION;
 
-	p->x = value;
+	*field = value;
 
 	return JS_UNDEFINED;
 }
 
-JSValue js_rl_vector3_get_y(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_bool_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Vector3* p = (Vector3*)JS_GetOpaque2(ctx, this_val, js_rl_vector3_class_id);
+	bool* field = (bool*)js_rl_get_field(ctx, this_val, magic);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->y);
-	else
+	if (!field)
 		return JS_EXCEPTION;
+
+	return JS_NewBool(ctx, *field);
 }
 
-JSValue js_rl_vector3_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_set_bool_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	Vector3* p = (Vector3*)JS_GetOpaque2(ctx, this_val, js_rl_vector3_class_id);
+	bool* field = (bool*)js_rl_get_field(ctx, this_val, magic);
 
-	if (!p)
+	if (!field)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
 	if (JS_IsNull(v))
 		return JS_UNDEFINED;
 
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->y = value;
+	*field = JS_ToBool(ctx, v);
 
 	return JS_UNDEFINED;
 }
 
-JSValue js_rl_vector3_get_z(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_nested_field(JSContext* ctx, JSValueConst this_val, int magic, JSRLPoolKind kind)
 {
-	Vector3* p = (Vector3*)JS_GetOpaque2(ctx, this_val, js_rl_vector3_class_id);
+	uint8_t* field = js_rl_get_field(ctx, this_val, magic);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->z);
-	else
+	if (!field)
 		return JS_EXCEPTION;
+
+	return js_rl_new_struct(ctx, kind, field);
 }
 
-JSValue js_rl_vector3_set_z(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_set_nested_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic, JSRLPoolKind kind)
 {
-	Vector3* p = (Vector3*)JS_GetOpaque2(ctx, this_val, js_rl_vector3_class_id);
+	uint8_t* field = js_rl_get_field(ctx, this_val, magic);
 
-	if (!p)
+	if (!field)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
 	if (JS_IsNull(v))
 		return JS_UNDEFINED;
 
-	double value;
+	void* value = JS_RL_GET_OPAQUE(ctx, v, *js_rl_pooled_classes[kind].class_id);
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (!value)
 		return JS_EXCEPTION;
 
-	p->z = value;
+	memcpy(field, value, js_rl_pooled_classes[kind].size);
 
 	return JS_UNDEFINED;
 }
 
-JSValue js_rl_new_vector3(JSContext* ctx, int x, int y, int z)
+static JSValue js_rl_get_vector2_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector3_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
-
-	Vector3* p = js_mallocz(ctx, sizeof(Vector3));
-
-	p->x = x;
-	p->y = y;
-	p->z = z;
-
-	JS_SetOpaque(obj, p);
-
-	return obj;
+	return js_rl_get_nested_field(ctx, this_val, magic, JS_RL_POOL_VECTOR2);
 }
 
-JSValue js_rl_vector3_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+static JSValue js_rl_set_vector2_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	int x, y, z;
-
-	if (JS_ToInt32(ctx, &x, argv[0]))
-		return JS_EXCEPTION;
-
-	if (JS_ToInt32(ctx, &y, argv[1]))
-		return JS_EXCEPTION;
-
-	if (JS_ToInt32(ctx, &z, argv[2]))
-		return JS_EXCEPTION;
-
-	return js_rl_new_vector3(ctx, x, y, z);
+	return js_rl_set_nested_field(ctx, this_val, v, magic, JS_RL_POOL_VECTOR2);
 }
 
-const JSCFunctionListEntry js_rl_vector3_proto_funcs[] =
+static JSValue js_rl_get_vector3_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	JS_CGETSET_DEF("x", js_rl_vector3_get_x, js_rl_vector3_set_x),
-	JS_CGETSET_DEF("y", js_rl_vector3_get_y, js_rl_vector3_set_y),
-	JS_CGETSET_DEF("z", js_rl_vector3_get_z, js_rl_vector3_set_z),
-};
+	return js_rl_get_nested_field(ctx, this_val, magic, JS_RL_POOL_VECTOR3);
+}
 
-void js_rl_init_vector3_class(JSContext* ctx, JSModuleDef* m)
+static JSValue js_rl_set_vector3_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_vector3_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_vector3_class_id, &js_rl_vector3_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_vector3_proto_funcs, countof(js_rl_vector3_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_vector3_class_id, proto);
-
-	obj = JS_NewCFunction2(ctx, js_rl_vector3_constructor, "Vector3", 3, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Vector3", obj);
+	return js_rl_set_nested_field(ctx, this_val, v, magic, JS_RL_POOL_VECTOR3);
 }
 
-#pragma endregion
-#pragma region Vector4
-
-JSClassDef js_rl_vector4_class = { "Vector4" };
-
-JSValue js_rl_vector4_get_x(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_matrix_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->x);
-	else
-		return JS_EXCEPTION;
+	return js_rl_get_nested_field(ctx, this_val, magic, JS_RL_POOL_MATRIX);
 }
 
-JSValue js_rl_vector4_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_set_matrix_field(JSContext* ctx, JSValueConst this_val, JSValueConst v, int magic)
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	return js_rl_set_nested_field(ctx, this_val, v, magic, JS_RL_POOL_MATRIX);
+}
 
-	double value;
+static JSValue js_rl_get_texture_field(JSContext* ctx, JSValueConst this_val, int magic)
+{
+	Texture2D* field = (Texture2D*)js_rl_get_field(ctx, this_val, magic);
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (!field)
 		return JS_EXCEPTION;
 
-	p->x = value;
-
-	return JS_UNDEFINED;
+	return js_rl_new_texture_view(ctx, *field, this_val);
 }
 
-JSValue js_rl_vector4_get_y(JSContext* ctx, JSValueConst this_val)
+static JSValue js_rl_get_image_field(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
+	Image* field = (Image*)js_rl_get_field(ctx, this_val, magic);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->y);
-	else
+	if (!field)
 		return JS_EXCEPTION;
+
+	return js_rl_new_image_view(ctx, *field, this_val);
 }
 
-JSValue js_rl_vector4_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+// Objects of the resource classes below own what they hold. On failure the
+// value isn't owned by anything yet, so the callers unload it.
+static JSValue js_rl_new_resource(JSContext* ctx, JSClassID class_id, const void* value, size_t size)
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
+	JSValue obj = JS_NewObjectClass(ctx, class_id);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (JS_IsException(obj))
+		return obj;
 
-	double value;
+	void* p = js_malloc(ctx, size);
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	p->y = value;
+	memcpy(p, value, size);
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_vector4_get_z(JSContext* ctx, JSValueConst this_val)
-{
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->z);
-	else
-		return JS_EXCEPTION;
-}
+#pragma endregion
+#pragma region Image
 
-JSValue js_rl_vector4_set_z(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+void js_rl_image_finalizer(JSRuntime* rt, JSValue val)
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
+	JSRLImage* p = (JSRLImage*)JS_GetOpaque(val, js_rl_image_class_id);
 
 	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+		return;
 
-	p->z = value;
+	if (JS_IsUndefined(p->owner))
+		UnloadImage(p->image);
+	else
+		JS_FreeValueRT(rt, p->owner);
 
-	return JS_UNDEFINED;
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_vector4_get_w(JSContext* ctx, JSValueConst this_val)
+static void js_rl_image_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
+	JSRLImage* p = (JSRLImage*)JS_GetOpaque(val, js_rl_image_class_id);
 
 	if (p)
-		return JS_NewFloat64(ctx, p->w);
-	else
-		return JS_EXCEPTION;
+		JS_MarkValue(rt, p->owner, mark_func);
 }
 
-JSValue js_rl_vector4_set_w(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_image_class =
 {
-	Vector4* p = (Vector4*)JS_GetOpaque2(ctx, this_val, js_rl_vector4_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->w = value;
+	"Image",
+	.finalizer = js_rl_image_finalizer,
+	.gc_mark = js_rl_image_mark,
+};
 
-	return JS_UNDEFINED;
-}
+const JSCFunctionListEntry js_rl_image_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("width", int, JS_RL_STRUCT_IMAGE, Image, width),
+	JS_RL_READONLY_FIELD("height", int, JS_RL_STRUCT_IMAGE, Image, height),
+	JS_RL_READONLY_FIELD("format", int, JS_RL_STRUCT_IMAGE, Image, format),
+	JS_RL_READONLY_FIELD("mipmaps", int, JS_RL_STRUCT_IMAGE, Image, mipmaps),
+};
 
-JSValue js_rl_new_vector4(JSContext* ctx, double x, double y, double z, double w)
+JSValue js_rl_new_image_view(JSContext* ctx, Image image, JSValueConst owner)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector4_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
 
 	if (JS_IsException(obj))
 		return obj;
 
-	Vector4* p = js_mallocz(ctx, sizeof(Vector4));
+	JSRLImage* p = js_malloc(ctx, sizeof(JSRLImage));
 
-	p->x = x;
-	p->y = y;
-	p->z = z;
-	p->w = w;
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
 
+	p->image = image;
+	p->owner = JS_DupValue(ctx, owner);
 	JS_SetOpaque(obj, p);
 
 	return obj;
 }
 
-JSValue js_rl_vector4_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+JSValue js_rl_new_image(JSContext* ctx, Image image)
 {
-	double x, y, z, w;
-
-	if (JS_ToFloat64(ctx, &x, argv[0]))
-		return JS_EXCEPTION;
+	JSValue obj = js_rl_new_image_view(ctx, image, JS_UNDEFINED);
 
-	if (JS_ToFloat64(ctx, &y, argv[1]))
-		return JS_EXCEPTION;
+	if (JS_IsException(obj))
+		UnloadImage(image);
 
-	if (JS_ToFloat64(ctx, &z, argv[2]))
-		return JS_EXCEPTION;
+	return obj;
+}
 
-	if (JS_ToFloat64(ctx, &w, argv[3]))
-		return JS_EXCEPTION;
+#pragma endregion
+#pragma region Vector2
 
-	return js_rl_new_vector4(ctx, x, y, z, w);
+void js_rl_vector2_finalizer(JSRuntime* rt, JSValue val)
+{
+	Vector2* p = (Vector2*)JS_GetOpaque(val, js_rl_vector2_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_VECTOR2, p);
 }
 
-const JSCFunctionListEntry js_rl_vector4_proto_funcs[] =
+JSClassDef js_rl_vector2_class =
 {
-	JS_CGETSET_DEF("x", js_rl_vector4_get_x, js_rl_vector4_set_x),
-	JS_CGETSET_DEF("y", js_rl_vector4_get_y, js_rl_vector4_set_y),
-	JS_CGETSET_DEF("z", js_rl_vector4_get_z, js_rl_vector4_set_z),
-	JS_CGETSET_DEF("w", js_rl_vector4_get_w, js_rl_vector4_set_w),
+	"Vector2",
+	.finalizer = js_rl_vector2_finalizer,
 };
 
-void js_rl_init_vector4_class(JSContext* ctx, JSModuleDef* m)
+const JSCFunctionListEntry js_rl_vector2_proto_funcs[] =
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_vector4_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_vector4_class_id, &js_rl_vector4_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_vector4_proto_funcs, countof(js_rl_vector4_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_vector4_class_id, proto);
+	JS_RL_FIELD("x", float, JS_RL_STRUCT_VECTOR2, Vector2, x),
+	JS_RL_FIELD("y", float, JS_RL_STRUCT_VECTOR2, Vector2, y),
+};
 
-	obj = JS_NewCFunction2(ctx, js_rl_vector4_constructor, "Vector4", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Vector4", obj);
-}
-
-#pragma endregion
-#pragma region Camera2D
+JSValue js_rl_new_vector2(JSContext* ctx, double x, double y)
+{
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector2_class_id);
 
-JSClassDef js_rl_camera2d_class = { "Camera2D" };
+	if (JS_IsException(obj))
+		return obj;
 
-JSValue js_rl_camera2d_get_offset(JSContext* ctx, JSValueConst this_val)
-{
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	Vector2* p = js_rl_pool_alloc(ctx, JS_RL_POOL_VECTOR2);
 
-	if (p)
+	if (!p)
 	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->offset);
-		return obj;
-	}
-	else
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
+
+	p->x = x;
+	p->y = y;
+
+	JS_SetOpaque(obj, p);
+
+	return obj;
 }
 
-JSValue js_rl_camera2d_set_offset(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_vector2_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	double x, y;
 
-	if (!p)
+	if (JS_RL_TO_FLOAT64(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (JS_RL_TO_FLOAT64(ctx, &y, argv[1]))
+		return JS_EXCEPTION;
+
+	return js_rl_new_vector2(ctx, x, y);
+}
 
-	p->offset = *(Vector2*)JS_GetOpaque2(ctx, v, js_rl_vector2_class_id);
+#pragma endregion
+#pragma region Vector3
 
-	return JS_UNDEFINED;
+void js_rl_vector3_finalizer(JSRuntime* rt, JSValue val)
+{
+	Vector3* p = (Vector3*)JS_GetOpaque(val, js_rl_vector3_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_VECTOR3, p);
 }
 
-JSValue js_rl_camera2d_get_target(JSContext* ctx, JSValueConst this_val)
+JSClassDef js_rl_vector3_class =
 {
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	"Vector3",
+	.finalizer = js_rl_vector3_finalizer,
+};
 
-	if (p)
-	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->target);
-		return obj;
-	}
-	else
-		return JS_EXCEPTION;
-}
+const JSCFunctionListEntry js_rl_vector3_proto_funcs[] =
+{
+	JS_RL_FIELD("x", float, JS_RL_STRUCT_VECTOR3, Vector3, x),
+	JS_RL_FIELD("y", float, JS_RL_STRUCT_VECTOR3, Vector3, y),
+	JS_RL_FIELD("z", float, JS_RL_STRUCT_VECTOR3, Vector3, z),
+};
 
-JSValue js_rl_camera2d_set_target(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_new_vector3(JSContext* ctx, double x, double y, double z)
 {
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector3_class_id);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	Vector3* p = js_rl_pool_alloc(ctx, JS_RL_POOL_VECTOR3);
 
 	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	p->x = x;
+	p->y = y;
+	p->z = z;
 
-	p->target = *(Vector2*)JS_GetOpaque2(ctx, v, js_rl_vector2_class_id);
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_camera2d_get_rotation(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_vector3_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	double x, y, z;
 
-	if (p)
-		return JS_NewFloat64(ctx, p->rotation);
-	else
+	if (JS_RL_TO_FLOAT64(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
-}
 
-JSValue js_rl_camera2d_set_rotation(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	if (JS_RL_TO_FLOAT64(ctx, &y, argv[1]))
+		return JS_EXCEPTION;
 
-	if (!p)
+	if (JS_RL_TO_FLOAT64(ctx, &z, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	return js_rl_new_vector3(ctx, x, y, z);
+}
 
-	double value;
+#pragma endregion
+#pragma region Vector4
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+void js_rl_vector4_finalizer(JSRuntime* rt, JSValue val)
+{
+	Vector4* p = (Vector4*)JS_GetOpaque(val, js_rl_vector4_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_VECTOR4, p);
+}
 
-	p->rotation = value;
+JSClassDef js_rl_vector4_class =
+{
+	"Vector4",
+	.finalizer = js_rl_vector4_finalizer,
+};
 
-	return JS_UNDEFINED;
-}
+const JSCFunctionListEntry js_rl_vector4_proto_funcs[] =
+{
+	JS_RL_FIELD("x", float, JS_RL_STRUCT_VECTOR4, Vector4, x),
+	JS_RL_FIELD("y", float, JS_RL_STRUCT_VECTOR4, Vector4, y),
+	JS_RL_FIELD("z", float, JS_RL_STRUCT_VECTOR4, Vector4, z),
+	JS_RL_FIELD("w", float, JS_RL_STRUCT_VECTOR4, Vector4, w),
+};
 
-JSValue js_rl_camera2d_get_zoom(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_new_vector4(JSContext* ctx, double x, double y, double z, double w)
 {
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_vector4_class_id);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->zoom);
-	else
+	if (JS_IsException(obj))
+		return obj;
+
+	Vector4* p = js_rl_pool_alloc(ctx, JS_RL_POOL_VECTOR4);
+
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
+
+	p->x = x;
+	p->y = y;
+	p->z = z;
+	p->w = w;
+
+	JS_SetOpaque(obj, p);
+
+	return obj;
 }
 
-JSValue js_rl_camera2d_set_zoom(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_vector4_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	Camera2D* p = (Camera2D*)JS_GetOpaque2(ctx, this_val, js_rl_camera2d_class_id);
+	double x, y, z, w;
 
-	if (!p)
+	if (JS_RL_TO_FLOAT64(ctx, &x, argv[0]))
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (JS_RL_TO_FLOAT64(ctx, &y, argv[1]))
+		return JS_EXCEPTION;
 
-	double value;
+	if (JS_RL_TO_FLOAT64(ctx, &z, argv[2]))
+		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (JS_RL_TO_FLOAT64(ctx, &w, argv[3]))
 		return JS_EXCEPTION;
 
-	p->zoom = value;
+	return js_rl_new_vector4(ctx, x, y, z, w);
+}
 
-	return JS_UNDEFINED;
+#pragma endregion
+#pragma region Camera2D
+
+void js_rl_camera2d_finalizer(JSRuntime* rt, JSValue val)
+{
+	Camera2D* p = (Camera2D*)JS_GetOpaque(val, js_rl_camera2d_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_CAMERA2D, p);
 }
 
+JSClassDef js_rl_camera2d_class =
+{
+	"Camera2D",
+	.finalizer = js_rl_camera2d_finalizer,
+};
+
+const JSCFunctionListEntry js_rl_camera2d_proto_funcs[] =
+{
+	JS_RL_FIELD("offset", vector2, JS_RL_STRUCT_CAMERA2D, Camera2D, offset),
+	JS_RL_FIELD("target", vector2, JS_RL_STRUCT_CAMERA2D, Camera2D, target),
+	JS_RL_FIELD("rotation", float, JS_RL_STRUCT_CAMERA2D, Camera2D, rotation),
+	JS_RL_FIELD("zoom", float, JS_RL_STRUCT_CAMERA2D, Camera2D, zoom),
+};
+
 JSValue js_rl_new_camera2d(JSContext* ctx, Vector2 offset, Vector2 target, double rotation, double zoom)
 {
 	JSValue obj = JS_NewObjectClass(ctx, js_rl_camera2d_class_id);
@@ -676,7 +607,13 @@ JSValue js_rl_new_camera2d(JSContext* ctx, Vector2 offset, Vector2 target, doubl
 	if (JS_IsException(obj))
 		return obj;
 
-	Camera2D* p = js_mallocz(ctx, sizeof(Camera2D));
+	Camera2D* p = js_rl_pool_alloc(ctx, JS_RL_POOL_CAMERA2D);
+
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
 
 	p->offset = offset;
 	p->target = target;
@@ -690,498 +627,455 @@ JSValue js_rl_new_camera2d(JSContext* ctx, Vector2 offset, Vector2 target, doubl
 
 JSValue js_rl_camera2d_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	Vector2* offset = (Vector2*)JS_GetOpaque2(ctx, argv[0], js_rl_vector2_class_id);
-	Vector2* target = (Vector2*)JS_GetOpaque2(ctx, argv[1], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, offset, argv[0], js_rl_vector2_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector2, target, argv[1], js_rl_vector2_class_id);
 	double rotation, zoom;
 
-	if (JS_ToFloat64(ctx, &rotation, argv[2]))
+	if (JS_RL_TO_FLOAT64(ctx, &rotation, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &zoom, argv[3]))
+	if (JS_RL_TO_FLOAT64(ctx, &zoom, argv[3]))
 		return JS_EXCEPTION;
 
-	return js_rl_new_camera2d(ctx, *offset, *target, rotation, zoom);
+	return js_rl_new_camera2d(ctx, offset, target, rotation, zoom);
 }
 
-const JSCFunctionListEntry js_rl_camera2d_proto_funcs[] =
-{
-	JS_CGETSET_DEF("offset", js_rl_camera2d_get_offset, js_rl_camera2d_set_offset),
-	JS_CGETSET_DEF("target", js_rl_camera2d_get_target, js_rl_camera2d_set_target),
-	JS_CGETSET_DEF("rotation", js_rl_camera2d_get_rotation, js_rl_camera2d_set_rotation),
-	JS_CGETSET_DEF("zoom", js_rl_camera2d_get_zoom, js_rl_camera2d_set_zoom),
-};
+#pragma endregion
+#pragma region Camera3D
 
-void js_rl_init_camera2d_class(JSContext* ctx, JSModuleDef* m)
+void js_rl_camera3d_finalizer(JSRuntime* rt, JSValue val)
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_camera2d_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_camera2d_class_id, &js_rl_camera2d_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_camera2d_proto_funcs, countof(js_rl_camera2d_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_camera2d_class_id, proto);
-
-	obj = JS_NewCFunction2(ctx, js_rl_camera2d_constructor, "Camera2D", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Camera2D", obj);
+	Camera3D* p = (Camera3D*)JS_GetOpaque(val, js_rl_camera3d_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_CAMERA3D, p);
 }
 
-#pragma endregion
-#pragma region Camera3D
+JSClassDef js_rl_camera3d_class =
+{
+	"Camera3D",
+	.finalizer = js_rl_camera3d_finalizer,
+};
 
-JSClassDef js_rl_camera3d_class = { "Camera3D" };
+const JSCFunctionListEntry js_rl_camera3d_proto_funcs[] =
+{
+	JS_RL_FIELD("position", vector3, JS_RL_STRUCT_CAMERA3D, Camera3D, position),
+	JS_RL_FIELD("target", vector3, JS_RL_STRUCT_CAMERA3D, Camera3D, target),
+	JS_RL_FIELD("up", vector3, JS_RL_STRUCT_CAMERA3D, Camera3D, up),
+	JS_RL_FIELD("fovY", float, JS_RL_STRUCT_CAMERA3D, Camera3D, fovy),
+	JS_RL_FIELD("type", int, JS_RL_STRUCT_CAMERA3D, Camera3D, type),
+};
 
-JSValue js_rl_camera3d_get_position(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_new_camera3d(JSContext* ctx, Vector3 position, Vector3 target, Vector3 up, double fovy, int type)
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_camera3d_class_id);
 
-	if (p)
-	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->position);
+	if (JS_IsException(obj))
 		return obj;
-	}
-	else
-		return JS_EXCEPTION;
-}
 
-JSValue js_rl_camera3d_set_position(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	Camera3D* p = js_rl_pool_alloc(ctx, JS_RL_POOL_CAMERA3D);
 
 	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	p->position = position;
+	p->target = target;
+	p->up = up;
+	p->fovy = fovy;
+	p->type = type;
 
-	p->position = *(Vector3*)JS_GetOpaque2(ctx, v, js_rl_vector3_class_id);
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_camera3d_get_target(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_camera3d_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector3, target, argv[1], js_rl_vector3_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector3, up, argv[2], js_rl_vector3_class_id);
+	double fovy;
+	int type;
 
-	if (p)
-	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->target);
-		return obj;
-	}
-	else
+	if (JS_RL_TO_FLOAT64(ctx, &fovy, argv[3]))
 		return JS_EXCEPTION;
-}
-
-JSValue js_rl_camera3d_set_target(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
 
-	if (!p)
+	if (JS_RL_TO_INT32(ctx, &type, argv[4]))
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	p->target = *(Vector3*)JS_GetOpaque2(ctx, v, js_rl_vector3_class_id);
-
-	return JS_UNDEFINED;
+	return js_rl_new_camera3d(ctx, position, target, up, fovy, type);
 }
 
-JSValue js_rl_camera3d_get_up(JSContext* ctx, JSValueConst this_val)
-{
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
-
-	if (p)
-	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->up);
-		return obj;
-	}
-	else
-		return JS_EXCEPTION;
-}
+#pragma endregion
+#pragma region Texture2D
 
-JSValue js_rl_camera3d_set_up(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+void js_rl_texture2d_finalizer(JSRuntime* rt, JSValue val)
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	JSRLTexture* p = (JSRLTexture*)JS_GetOpaque(val, js_rl_texture2d_class_id);
 
 	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+		return;
 
-	p->up = *(Vector3*)JS_GetOpaque2(ctx, v, js_rl_vector3_class_id);
+	if (JS_IsUndefined(p->owner))
+		UnloadTexture(p->texture);
+	else
+		JS_FreeValueRT(rt, p->owner);
 
-	return JS_UNDEFINED;
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_camera3d_get_fov_y(JSContext* ctx, JSValueConst this_val)
+static void js_rl_texture2d_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	JSRLTexture* p = (JSRLTexture*)JS_GetOpaque(val, js_rl_texture2d_class_id);
 
 	if (p)
-		return JS_NewFloat64(ctx, p->fovy);
-	else
-		return JS_EXCEPTION;
+		JS_MarkValue(rt, p->owner, mark_func);
 }
 
-JSValue js_rl_camera3d_set_fov_y(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_texture2d_class =
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	"Texture2D",
+	.finalizer = js_rl_texture2d_finalizer,
+	.gc_mark = js_rl_texture2d_mark,
+};
 
-	if (!p)
-		return JS_EXCEPTION;
+const JSCFunctionListEntry js_rl_texture2d_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("id", uint, JS_RL_STRUCT_TEXTURE2D, Texture2D, id),
+	JS_RL_READONLY_FIELD("width", int, JS_RL_STRUCT_TEXTURE2D, Texture2D, width),
+	JS_RL_READONLY_FIELD("height", int, JS_RL_STRUCT_TEXTURE2D, Texture2D, height),
+	JS_RL_READONLY_FIELD("format", int, JS_RL_STRUCT_TEXTURE2D, Texture2D, format),
+	JS_RL_READONLY_FIELD("mipmaps", int, JS_RL_STRUCT_TEXTURE2D, Texture2D, mipmaps),
+};
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+JSValue js_rl_new_texture_view(JSContext* ctx, Texture2D texture, JSValueConst owner)
+{
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_texture2d_class_id);
 
-	double value;
+	if (JS_IsException(obj))
+		return obj;
+
+	JSRLTexture* p = js_malloc(ctx, sizeof(JSRLTexture));
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	p->fovy = value;
+	p->texture = texture;
+	p->owner = JS_DupValue(ctx, owner);
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_camera3d_get_type(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_new_texture(JSContext* ctx, Texture2D texture)
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	JSValue obj = js_rl_new_texture_view(ctx, texture, JS_UNDEFINED);
 
-	if (p)
-		return JS_NewInt32(ctx, p->type);
-	else
-		return JS_EXCEPTION;
+	if (JS_IsException(obj))
+		UnloadTexture(texture);
+
+	return obj;
 }
 
-JSValue js_rl_camera3d_set_type(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+#pragma endregion
+#pragma region RenderTexture
+
+void js_rl_render_texture_finalizer(JSRuntime* rt, JSValue val)
 {
-	Camera3D* p = (Camera3D*)JS_GetOpaque2(ctx, this_val, js_rl_camera3d_class_id);
+	RenderTexture* p = (RenderTexture*)JS_GetOpaque(val, js_rl_render_texture_class_id);
 
 	if (!p)
-		return JS_EXCEPTION;
+		return;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	UnloadRenderTexture(*p);
+	js_free_rt(rt, p);
+}
 
-	int value;
+JSClassDef js_rl_render_texture_class =
+{
+	"RenderTexture2D",
+	.finalizer = js_rl_render_texture_finalizer,
+};
 
-	if (JS_ToInt32(ctx, &value, v))
-		return JS_EXCEPTION;
+// The attachments are views, they stay owned by the render texture
+const JSCFunctionListEntry js_rl_render_texture_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("id", uint, JS_RL_STRUCT_RENDER_TEXTURE, RenderTexture2D, id),
+	JS_RL_READONLY_FIELD("texture", texture, JS_RL_STRUCT_RENDER_TEXTURE, RenderTexture2D, texture),
+	JS_RL_READONLY_FIELD("depth", texture, JS_RL_STRUCT_RENDER_TEXTURE, RenderTexture2D, depth),
+	JS_RL_FIELD("depthTexture", bool, JS_RL_STRUCT_RENDER_TEXTURE, RenderTexture2D, depthTexture),
+};
+
+JSValue js_rl_render_texture_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+{
+	int w, h;
 
-	p->type = value;
+	if (JS_RL_TO_INT32(ctx, &w, argv[0]))
+		return JS_EXCEPTION;
 
-	return JS_UNDEFINED;
-}
+	if (JS_RL_TO_INT32(ctx, &h, argv[1]))
+		return JS_EXCEPTION;
 
-JSValue js_rl_new_camera3d(JSContext* ctx, Vector3 position, Vector3 target, Vector3 up, double fovy, int type)
-{
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_camera3d_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_render_texture_class_id);
 
 	if (JS_IsException(obj))
 		return obj;
 
-	Camera3D* p = js_mallocz(ctx, sizeof(Camera3D));
+	RenderTexture2D* p = js_mallocz(ctx, sizeof(RenderTexture2D));
 
-	p->position = position;
-	p->target = target;
-	p->up = up;
-	p->fovy = fovy;
-	p->type = type;
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
 
+	*p = LoadRenderTexture(w, h);
 	JS_SetOpaque(obj, p);
 
 	return obj;
 }
 
-JSValue js_rl_camera3d_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
-{
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-	Vector3* target = (Vector3*)JS_GetOpaque2(ctx, argv[1], js_rl_vector3_class_id);
-	Vector3* up = (Vector3*)JS_GetOpaque2(ctx, argv[3], js_rl_vector3_class_id);
-	double fovy;
-	int type;
-
-	JS_ToFloat64(ctx, &fovy, argv[4]);
-	JS_ToInt32(ctx, &type, argv[5]);
-
-	return js_rl_new_camera3d(ctx, *position, *target, *up, fovy, type);
-}
-
-const JSCFunctionListEntry js_rl_camera3d_proto_funcs[] =
-{
-	JS_CGETSET_DEF("position", js_rl_camera3d_get_position, js_rl_camera3d_set_position),
-	JS_CGETSET_DEF("target", js_rl_camera3d_get_target, js_rl_camera3d_set_target),
-	JS_CGETSET_DEF("up", js_rl_camera3d_get_up, js_rl_camera3d_set_up),
-	JS_CGETSET_DEF("fovY", js_rl_camera3d_get_fov_y, js_rl_camera3d_set_fov_y),
-	JS_CGETSET_DEF("type", js_rl_camera3d_get_type, js_rl_camera3d_set_type),
-};
-
-void js_rl_init_camera3d_class(JSContext* ctx, JSModuleDef* m)
-{
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_camera3d_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_camera3d_class_id, &js_rl_camera3d_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_camera3d_proto_funcs, countof(js_rl_camera3d_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_camera3d_class_id, proto);
-
-	obj = JS_NewCFunction2(ctx, js_rl_camera3d_constructor, "Camera3D", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Camera3D", obj);
-}
-
 #pragma endregion
-#pragma region Texture2D
+#pragma region Ray
 
-void js_rl_texture2d_finalizer(JSRuntime* rt, JSValue val)
+void js_rl_ray_finalizer(JSRuntime* rt, JSValue val)
 {
-	Texture2D* p = (Texture2D*)JS_GetOpaque(val, js_rl_texture2d_class_id);
-	UnloadTexture(*p);
+	Ray* p = (Ray*)JS_GetOpaque(val, js_rl_ray_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_RAY, p);
 }
 
-JSClassDef js_rl_texture2d_class =
+JSClassDef js_rl_ray_class =
 {
-	"Texture2D",
-	.finalizer = js_rl_texture2d_finalizer,
+	"Ray",
+	.finalizer = js_rl_ray_finalizer,
 };
 
-JSValue js_rl_texture2d_get_id(JSContext* ctx, JSValueConst this_val)
+const JSCFunctionListEntry js_rl_ray_proto_funcs[] =
 {
-	Texture2D* p = (Texture2D*)JS_GetOpaque2(ctx, this_val, js_rl_texture2d_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->id);
-	else
-		return JS_EXCEPTION;
-}
+	JS_RL_FIELD("position", vector3, JS_RL_STRUCT_RAY, Ray, position),
+	JS_RL_FIELD("direction", vector3, JS_RL_STRUCT_RAY, Ray, direction),
+};
 
-JSValue js_rl_texture2d_get_width(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_new_ray(JSContext* ctx, Vector3 position, Vector3 direction)
 {
-	Texture2D* p = (Texture2D*)JS_GetOpaque2(ctx, this_val, js_rl_texture2d_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_ray_class_id);
 
-	if (p)
-		return JS_NewInt32(ctx, p->width);
-	else
-		return JS_EXCEPTION;
-}
+	if (JS_IsException(obj))
+		return obj;
 
-JSValue js_rl_texture2d_get_height(JSContext* ctx, JSValueConst this_val)
-{
-	Texture2D* p = (Texture2D*)JS_GetOpaque2(ctx, this_val, js_rl_texture2d_class_id);
+	Ray* p = js_rl_pool_alloc(ctx, JS_RL_POOL_RAY);
 
-	if (p)
-		return JS_NewInt32(ctx, p->height);
-	else
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
-}
-
-JSValue js_rl_texture2d_get_format(JSContext* ctx, JSValueConst this_val)
-{
-	Texture2D* p = (Texture2D*)JS_GetOpaque2(ctx, this_val, js_rl_texture2d_class_id);
+	}
 
-	if (p)
-		return JS_NewInt32(ctx, p->format);
-	else
-		return JS_EXCEPTION;
-}
+	p->position = position;
+	p->direction = direction;
 
-JSValue js_rl_texture2d_get_mipmaps(JSContext* ctx, JSValueConst this_val)
-{
-	Texture2D* p = (Texture2D*)JS_GetOpaque2(ctx, this_val, js_rl_texture2d_class_id);
+	JS_SetOpaque(obj, p);
 
-	if (p)
-		return JS_NewInt32(ctx, p->mipmaps);
-	else
-		return JS_EXCEPTION;
+	return obj;
 }
 
-const JSCFunctionListEntry js_rl_texture2d_proto_funcs[] =
+JSValue js_rl_ray_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	JS_CGETSET_DEF("id", js_rl_texture2d_get_id, NULL),
-	JS_CGETSET_DEF("width", js_rl_texture2d_get_width, NULL),
-	JS_CGETSET_DEF("height", js_rl_texture2d_get_height, NULL),
-	JS_CGETSET_DEF("format", js_rl_texture2d_get_format, NULL),
-	JS_CGETSET_DEF("mipmaps", js_rl_texture2d_get_mipmaps, NULL),
-};
+	JS_RL_ARG_VALUE(ctx, Vector3, position, argv[0], js_rl_vector3_class_id);
+	JS_RL_ARG_VALUE(ctx, Vector3, direction, argv[1], js_rl_vector3_class_id);
 
-void js_rl_init_texture2d_class(JSContext* ctx, JSModuleDef* m)
-{
-	JSValue proto;
-	JS_NewClassID(&js_rl_texture2d_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_texture2d_class_id, &js_rl_texture2d_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_texture2d_proto_funcs, countof(js_rl_texture2d_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_texture2d_class_id, proto);
+	return js_rl_new_ray(ctx, position, direction);
 }
 
 #pragma endregion
-#pragma region RenderTexture
+#pragma region Matrix
 
-void js_rl_render_texture_finalizer(JSRuntime* rt, JSValue val)
+void js_rl_matrix_finalizer(JSRuntime* rt, JSValue val)
 {
-	RenderTexture* p = (RenderTexture*)JS_GetOpaque(val, js_rl_render_texture_class_id);
-	UnloadRenderTexture(*p);
+	Matrix* p = (Matrix*)JS_GetOpaque(val, js_rl_matrix_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_MATRIX, p);
 }
 
-JSClassDef js_rl_render_texture_class =
+JSClassDef js_rl_matrix_class =
 {
-	"RenderTexture2D",
-	.finalizer = js_rl_render_texture_finalizer,
+	"Matrix",
+	.finalizer = js_rl_matrix_finalizer,
 };
 
-JSValue js_rl_render_texture_get_id(JSContext* ctx, JSValueConst this_val)
+const JSCFunctionListEntry js_rl_matrix_proto_funcs[] =
 {
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->id);
-	else
-		return JS_EXCEPTION;
-}
+	JS_RL_FIELD("m0", float, JS_RL_STRUCT_MATRIX, Matrix, m0),
+	JS_RL_FIELD("m1", float, JS_RL_STRUCT_MATRIX, Matrix, m1),
+	JS_RL_FIELD("m2", float, JS_RL_STRUCT_MATRIX, Matrix, m2),
+	JS_RL_FIELD("m3", float, JS_RL_STRUCT_MATRIX, Matrix, m3),
+	JS_RL_FIELD("m4", float, JS_RL_STRUCT_MATRIX, Matrix, m4),
+	JS_RL_FIELD("m5", float, JS_RL_STRUCT_MATRIX, Matrix, m5),
+	JS_RL_FIELD("m6", float, JS_RL_STRUCT_MATRIX, Matrix, m6),
+	JS_RL_FIELD("m7", float, JS_RL_STRUCT_MATRIX, Matrix, m7),
+	JS_RL_FIELD("m8", float, JS_RL_STRUCT_MATRIX, Matrix, m8),
+	JS_RL_FIELD("m9", float, JS_RL_STRUCT_MATRIX, Matrix, m9),
+	JS_RL_FIELD("m10", float, JS_RL_STRUCT_MATRIX, Matrix, m10),
+	JS_RL_FIELD("m11", float, JS_RL_STRUCT_MATRIX, Matrix, m11),
+	JS_RL_FIELD("m12", float, JS_RL_STRUCT_MATRIX, Matrix, m12),
+	JS_RL_FIELD("m13", float, JS_RL_STRUCT_MATRIX, Matrix, m13),
+	JS_RL_FIELD("m14", float, JS_RL_STRUCT_MATRIX, Matrix, m14),
+	JS_RL_FIELD("m15", float, JS_RL_STRUCT_MATRIX, Matrix, m15),
+};
 
-JSValue js_rl_render_texture_set_id(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_new_matrix(JSContext* ctx, double m0, double m1, double m2, double m3, double m4, double m5, double m6, double m7, double m8, double m9, double m10, double m11, double m12, double m13, double m14, double m15)
 {
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_matrix_class_id);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (JS_IsException(obj))
+		return obj;
 
-	int value;
+	Matrix* p = js_rl_pool_alloc(ctx, JS_RL_POOL_MATRIX);
 
-	if (JS_ToInt32(ctx, &value, v))
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
+
+	p->m0 = m0;
+	p->m1 = m1;
+	p->m2 = m2;
+	p->m3 = m3;
+	p->m4 = m4;
+	p->m5 = m5;
+	p->m6 = m6;
+	p->m7 = m7;
+	p->m8 = m8;
+	p->m9 = m9;
+	p->m10 = m10;
+	p->m11 = m11;
+	p->m12 = m12;
+	p->m13 = m13;
+	p->m14 = m14;
+	p->m15 = m15;
 
-	p->id = value;
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_render_texture_get_texture(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_matrix_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
+	double m[16];
 
-	if (p)
+	for (int i = 0; i < 16; i++)
 	{
-		JSValue obj = JS_NewObjectClass(ctx, js_rl_texture2d_class_id);
-		if (!JS_IsException(obj))
-			JS_SetOpaque(obj, &p->texture);
-		return obj;
+		if (JS_RL_TO_FLOAT64(ctx, &m[i], argv[i]))
+			return JS_EXCEPTION;
 	}
-	else
-		return JS_EXCEPTION;
-}
 
-JSValue js_rl_render_texture_set_texture(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
+	return js_rl_new_matrix(ctx, m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7], m[8], m[9], m[10], m[11], m[12], m[13], m[14], m[15]);
+}
 
-	if (!p)
-		return JS_EXCEPTION;
+#pragma endregion
+#pragma region Color
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+void js_rl_color_finalizer(JSRuntime* rt, JSValue val)
+{
+	Color* p = (Color*)JS_GetOpaque(val, js_rl_color_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_COLOR, p);
+}
 
-	Texture value = *(Texture *)JS_GetOpaque2(ctx, v, js_rl_texture2d_class_id);
-	p->texture = value;
+JSClassDef js_rl_color_class =
+{
+	"Color",
+	.finalizer = js_rl_color_finalizer,
+};
 
-	return JS_UNDEFINED;
-}
+const JSCFunctionListEntry js_rl_color_proto_funcs[] =
+{
+	JS_RL_FIELD("r", uchar, JS_RL_STRUCT_COLOR, Color, r),
+	JS_RL_FIELD("g", uchar, JS_RL_STRUCT_COLOR, Color, g),
+	JS_RL_FIELD("b", uchar, JS_RL_STRUCT_COLOR, Color, b),
+	JS_RL_FIELD("a", uchar, JS_RL_STRUCT_COLOR, Color, a),
+};
 
-JSValue js_rl_render_texture_get_depth(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_new_color(JSContext* ctx, int r, int g, int b, int a)
 {
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_color_class_id);
 
-	if (p)
-	{
-		JSValue obj = JS_NewObjectClass(ctx, js_rl_texture2d_class_id);
-		if (!JS_IsException(obj))
-			JS_SetOpaque(obj, &p->depth);
+	if (JS_IsException(obj))
 		return obj;
-	}
-	else
-		return JS_EXCEPTION;
-}
 
-JSValue js_rl_render_texture_set_depth(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
+	Color* p = js_rl_pool_alloc(ctx, JS_RL_POOL_COLOR);
 
 	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	p->r = r;
+	p->g = g;
+	p->b = b;
+	p->a = a;
 
-	Texture value = *(Texture *)JS_GetOpaque2(ctx, v, js_rl_texture2d_class_id);
-	p->depth = value;
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_render_texture_get_depth_texture(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_color_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
+	int r, g, b, a;
 
-	if (p)
-		return JS_NewBool(ctx, p->depthTexture);
-	else
+	if (JS_RL_TO_INT32(ctx, &r, argv[0]))
 		return JS_EXCEPTION;
-}
 
-JSValue js_rl_render_texture_set_depth_texture(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	RenderTexture2D* p = (RenderTexture2D*)JS_GetOpaque2(ctx, this_val, js_rl_render_texture_class_id);
+	if (JS_RL_TO_INT32(ctx, &g, argv[1]))
+		return JS_EXCEPTION;
 
-	if (!p)
+	if (JS_RL_TO_INT32(ctx, &b, argv[2]))
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (JS_IsUndefined(argv[3]))
+		a = 255;
+	else if (JS_RL_TO_INT32(ctx, &a, argv[3]))
+		return JS_EXCEPTION;
 
-	bool value = JS_ToBool(ctx, v);
+	return js_rl_new_color(ctx, r, g, b, a);
+}
 
-	p->depthTexture = value;
+#pragma endregion
+#pragma region Rectangle
 
-	return JS_UNDEFINED;
+void js_rl_rectangle_finalizer(JSRuntime* rt, JSValue val)
+{
+	Rectangle* p = (Rectangle*)JS_GetOpaque(val, js_rl_rectangle_class_id);
+	js_rl_pool_free(rt, JS_RL_POOL_RECTANGLE, p);
 }
 
-JSValue js_rl_render_texture_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+JSClassDef js_rl_rectangle_class =
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_render_texture_class_id);
+	"Rectangle",
+	.finalizer = js_rl_rectangle_finalizer,
+};
 
-	int w, h;
+const JSCFunctionListEntry js_rl_rectangle_proto_funcs[] =
+{
+	JS_RL_FIELD("x", float, JS_RL_STRUCT_RECTANGLE, Rectangle, x),
+	JS_RL_FIELD("y", float, JS_RL_STRUCT_RECTANGLE, Rectangle, y),
+	JS_RL_FIELD("width", float, JS_RL_STRUCT_RECTANGLE, Rectangle, width),
+	JS_RL_FIELD("height", float, JS_RL_STRUCT_RECTANGLE, Rectangle, height),
+};
 
-	if (JS_ToInt32(ctx, &w, argv[0]))
-		return JS_EXCEPTION;
+JSValue js_rl_new_rectangle(JSContext* ctx, double x, double y, double w, double h)
+{
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_rectangle_class_id);
 
-	if (JS_ToInt32(ctx, &h, argv[1]))
-		return JS_EXCEPTION;
+	if (JS_IsException(obj))
+		return obj;
 
-	RenderTexture2D* p = js_mallocz(ctx, sizeof(RenderTexture2D));
-	RenderTexture2D rt = LoadRenderTexture(w, h);
+	Rectangle* p = js_rl_pool_alloc(ctx, JS_RL_POOL_RECTANGLE);
 
 	if (!p)
 	{
@@ -1189,1312 +1083,1126 @@ JSValue js_rl_render_texture_constructor(JSContext* ctx, JSValueConst new_target
 		return JS_EXCEPTION;
 	}
 
-	memcpy(p, &rt, sizeof(rt));
+	p->x = x;
+	p->y = y;
+	p->width = w;
+	p->height = h;
 
 	JS_SetOpaque(obj, p);
 
 	return obj;
 }
 
-const JSCFunctionListEntry js_rl_render_texture_proto_funcs[] =
-{
-	JS_CGETSET_DEF("x", js_rl_render_texture_get_id, js_rl_render_texture_set_id),
-	JS_CGETSET_DEF("y", js_rl_render_texture_get_texture, js_rl_render_texture_set_texture),
-	JS_CGETSET_DEF("z", js_rl_render_texture_get_depth, js_rl_render_texture_set_depth),
-	JS_CGETSET_DEF("w", js_rl_render_texture_get_depth_texture, js_rl_render_texture_set_depth_texture),
-};
-
-void js_rl_init_render_texture_class(JSContext* ctx, JSModuleDef* m)
+JSValue js_rl_rectangle_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_render_texture_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_render_texture_class_id, &js_rl_render_texture_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_render_texture_proto_funcs, countof(js_rl_render_texture_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_render_texture_class_id, proto);
+	double x, y, w, h;
 
-	obj = JS_NewCFunction2(ctx, js_rl_render_texture_constructor, "RenderTexture2D", 2, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "RenderTexture2D", obj);
-}
+	if (JS_RL_TO_FLOAT64(ctx, &x, argv[0]))
+		return JS_EXCEPTION;
 
-#pragma endregion
-#pragma region Ray
+	if (JS_RL_TO_FLOAT64(ctx, &y, argv[1]))
+		return JS_EXCEPTION;
 
-JSClassDef js_rl_ray_class = { "Ray" };
+	if (JS_RL_TO_FLOAT64(ctx, &w, argv[2]))
+		return JS_EXCEPTION;
 
-JSValue js_rl_ray_get_position(JSContext* ctx, JSValueConst this_val)
-{
-	Ray* p = (Ray*)JS_GetOpaque2(ctx, this_val, js_rl_ray_class_id);
+	if (JS_RL_TO_FLOAT64(ctx, &h, argv[3]))
+		return JS_EXCEPTION;
 
-	if (p)
-	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->position);
-		return obj;
-	}
-	else
-		return JS_EXCEPTION;
+	return js_rl_new_rectangle(ctx, x, y, w, h);
 }
 
-JSValue js_rl_ray_set_position(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Ray* p = (Ray*)JS_GetOpaque2(ctx, this_val, js_rl_ray_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	p->position = *(Vector3*)JS_GetOpaque2(ctx, v, js_rl_vector3_class_id);
-
-	return JS_UNDEFINED;
-}
+#pragma endregion
+#pragma region CharInfo
 
-JSValue js_rl_ray_get_direction(JSContext* ctx, JSValueConst this_val)
+// The glyph image isn't unloaded with the wrapper: it belongs to the font or
+// to the glyph data it was copied from, and is only ever exposed as a view
+void js_rl_char_info_finalizer(JSRuntime* rt, JSValue val)
 {
-	Ray* p = (Ray*)JS_GetOpaque2(ctx, this_val, js_rl_ray_class_id);
+	CharInfo* p = (CharInfo*)JS_GetOpaque(val, js_rl_char_info_class_id);
 
-	if (p)
-	{
-		JSValue obj = JS_NewObject(ctx);
-		JS_SetOpaque(obj, &p->direction);
-		return obj;
-	}
-	else
-		return JS_EXCEPTION;
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_ray_set_direction(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_char_info_class =
 {
-	Ray* p = (Ray*)JS_GetOpaque2(ctx, this_val, js_rl_ray_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	p->direction = *(Vector3*)JS_GetOpaque2(ctx, v, js_rl_vector3_class_id);
+	"CharInfo",
+	.finalizer = js_rl_char_info_finalizer,
+};
 
-	return JS_UNDEFINED;
-}
+const JSCFunctionListEntry js_rl_char_info_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("value", int, JS_RL_STRUCT_CHAR_INFO, CharInfo, value),
+	JS_RL_READONLY_FIELD("offsetX", int, JS_RL_STRUCT_CHAR_INFO, CharInfo, offsetX),
+	JS_RL_READONLY_FIELD("offsetY", int, JS_RL_STRUCT_CHAR_INFO, CharInfo, offsetY),
+	JS_RL_READONLY_FIELD("advanceX", int, JS_RL_STRUCT_CHAR_INFO, CharInfo, advanceX),
+	JS_RL_READONLY_FIELD("image", image, JS_RL_STRUCT_CHAR_INFO, CharInfo, image),
+};
 
-JSValue js_rl_new_ray(JSContext* ctx, Vector3 position, Vector3 direction)
+JSValue js_rl_new_char_info(JSContext* ctx, CharInfo character)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_ray_class_id);
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_char_info_class_id);
 
 	if (JS_IsException(obj))
 		return obj;
 
-	Ray* p = js_mallocz(ctx, sizeof(Ray));
+	CharInfo* p = js_malloc(ctx, sizeof(CharInfo));
 
-	p->position = position;
-	p->direction = direction;
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
 
+	*p = character;
 	JS_SetOpaque(obj, p);
 
 	return obj;
 }
 
-JSValue js_rl_ray_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
-{
-	Vector3* position = (Vector3*)JS_GetOpaque2(ctx, argv[0], js_rl_vector3_class_id);
-	Vector3* direction = (Vector3*)JS_GetOpaque2(ctx, argv[1], js_rl_vector3_class_id);
-
-	return js_rl_new_ray(ctx, *position, *direction);
-}
-
-const JSCFunctionListEntry js_rl_ray_proto_funcs[] =
-{
-	JS_CGETSET_DEF("position", js_rl_ray_get_position, js_rl_ray_set_position),
-	JS_CGETSET_DEF("target", js_rl_ray_get_direction, js_rl_ray_set_direction),
-};
-
-void js_rl_init_ray_class(JSContext* ctx, JSModuleDef* m)
-{
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_ray_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_ray_class_id, &js_rl_ray_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_ray_proto_funcs, countof(js_rl_ray_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_ray_class_id, proto);
-
-	obj = JS_NewCFunction2(ctx, js_rl_ray_constructor, "Ray", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Ray", obj);
-}
-
 #pragma endregion
-#pragma region Matrix
-
-JSClassDef js_rl_matrix_class = { "Matrix" };
-
-JSValue js_rl_matrix_get_m0(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m0);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m1(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m1);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m2(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m2);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m3(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m3);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m4(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m4);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m5(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m5);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m6(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m6);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m7(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m7);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m8(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m8);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m9(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (p)
-		return JS_NewFloat64(ctx, p->m9);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m10(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+#pragma region Font
 
-	if (p)
-		return JS_NewFloat64(ctx, p->m10);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m11(JSContext* ctx, JSValueConst this_val)
+void js_rl_font_finalizer(JSRuntime* rt, JSValue val)
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	JSRLFont* p = (JSRLFont*)JS_GetOpaque(val, js_rl_font_class_id);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->m11);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m12(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	if (!p)
+		return;
 
-	if (p)
-		return JS_NewFloat64(ctx, p->m12);
+	if (JS_IsUndefined(p->owner))
+	{
+		js_rl_forget_font_layouts(p->font);
+		UnloadFont(p->font);
+	}
 	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m13(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+		JS_FreeValueRT(rt, p->owner);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->m13);
-	else
-		return JS_EXCEPTION;
+	JS_FreeValueRT(rt, p->glyph_metrics);
+	js_free_rt(rt, p);
 }
-JSValue js_rl_matrix_get_m14(JSContext* ctx, JSValueConst this_val)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->m14);
-	else
-		return JS_EXCEPTION;
-}
-JSValue js_rl_matrix_get_m15(JSContext* ctx, JSValueConst this_val)
+static void js_rl_font_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	JSRLFont* p = (JSRLFont*)JS_GetOpaque(val, js_rl_font_class_id);
 
 	if (p)
-		return JS_NewFloat64(ctx, p->m15);
-	else
-		return JS_EXCEPTION;
-}
-
-JSValue js_rl_matrix_set_m0(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m0 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m1(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m1 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m2(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m2 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m3(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m3 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m4(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m4 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m5(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m5 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m6(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m6 = value;
-
-	return JS_UNDEFINED;
-}
-
-JSValue js_rl_matrix_set_m7(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m7 = value;
-
-	return JS_UNDEFINED;
+	{
+		JS_MarkValue(rt, p->glyph_metrics, mark_func);
+		JS_MarkValue(rt, p->owner, mark_func);
+	}
 }
 
-JSValue js_rl_matrix_set_m8(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_font_class =
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
-
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
-
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
-
-	p->m8 = value;
-
-	return JS_UNDEFINED;
-}
+	"Font",
+	.finalizer = js_rl_font_finalizer,
+	.gc_mark = js_rl_font_mark,
+};
 
-JSValue js_rl_matrix_set_m9(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_new_font_view(JSContext* ctx, Font font, JSValueConst owner)
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
-
-	if (!p)
-		return JS_EXCEPTION;
+	JSValue obj = JS_NewObjectClass(ctx, js_rl_font_class_id);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (JS_IsException(obj))
+		return obj;
 
-	double value;
+	JSRLFont* p = js_mallocz(ctx, sizeof(JSRLFont));
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (!p) {
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	p->m9 = value;
+	p->font = font;
+	p->glyph_metrics = JS_UNDEFINED;
+	p->owner = JS_DupValue(ctx, owner);
+	JS_SetOpaque(obj, p);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_matrix_set_m10(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_new_font(JSContext* ctx, Font font)
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	return js_rl_new_font_view(ctx, font, JS_UNDEFINED);
+}
 
-	if (!p)
-		return JS_EXCEPTION;
+JSValue js_rl_font_get_chars(JSContext* ctx, JSValueConst this_val)
+{
+	Font* p = (Font*)JS_GetOpaque2(ctx, this_val, js_rl_font_class_id);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	if (p)
+	{
+		JSValue arr = JS_NewArray(ctx);
 
-	double value;
+		for (int i = 0; i < p->charsCount; i++)
+		{
+			JSValue obj = js_rl_new_char_info(ctx, p->chars[i]);
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+			if (JS_IsException(obj))
+			{
+				JS_FreeValue(ctx, arr);
+				return obj;
+			}
 
-	p->m10 = value;
+			JS_SetPropertyInt64(ctx, arr, i, obj);
+		}
 
-	return JS_UNDEFINED;
+		return arr;
+	}
+	else
+		return JS_EXCEPTION;
 }
 
-JSValue js_rl_matrix_set_m11(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_font_get_glyph_metrics(JSContext* ctx, JSValueConst this_val)
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	JSRLFont* p = (JSRLFont*)JS_GetOpaque2(ctx, this_val, js_rl_font_class_id);
 
 	if (!p)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	// Built on first access, later reads share the same view
+	if (JS_IsUndefined(p->glyph_metrics))
+	{
+		size_t count = max_int(p->font.charsCount, 0);
+		JSValue buffer = js_rl_new_array_buffer(ctx, count * JS_RL_GLYPH_METRICS_FLOATS * sizeof(float));
 
-	double value;
+		if (JS_IsException(buffer))
+			return buffer;
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+		size_t size;
+		float* metrics = (float*)JS_GetArrayBuffer(ctx, &size, buffer);
 
-	p->m11 = value;
+		for (size_t i = 0; i < count; i++, metrics += JS_RL_GLYPH_METRICS_FLOATS)
+		{
+			CharInfo* glyph = &p->font.chars[i];
+			Rectangle rec = p->font.recs[i];
+
+			metrics[0] = (float)glyph->value;
+			metrics[1] = (float)glyph->offsetX;
+			metrics[2] = (float)glyph->offsetY;
+			metrics[3] = (float)glyph->advanceX;
+			metrics[4] = rec.x;
+			metrics[5] = rec.y;
+			metrics[6] = rec.width;
+			metrics[7] = rec.height;
+		}
 
-	return JS_UNDEFINED;
+		JSValue view = js_rl_new_typed_array(ctx, "Float32Array", buffer, 0, count * JS_RL_GLYPH_METRICS_FLOATS);
+		JS_FreeValue(ctx, buffer);
+
+		if (JS_IsException(view))
+			return view;
+
+		p->glyph_metrics = view;
+	}
+
+	return JS_DupValue(ctx, p->glyph_metrics);
 }
 
-JSValue js_rl_matrix_set_m12(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+// JSRLFont starts with the Font, field offsets are the same
+const JSCFunctionListEntry js_rl_font_proto_funcs[] =
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	JS_RL_READONLY_FIELD("texture", texture, JS_RL_STRUCT_FONT, Font, texture),
+	JS_RL_READONLY_FIELD("baseSize", int, JS_RL_STRUCT_FONT, Font, baseSize),
+	JS_RL_READONLY_FIELD("charsCount", int, JS_RL_STRUCT_FONT, Font, charsCount),
+	JS_CGETSET_DEF("chars", js_rl_font_get_chars, NULL),
+	JS_CGETSET_DEF("glyphMetrics", js_rl_font_get_glyph_metrics, NULL),
+};
 
-	if (!p)
-		return JS_EXCEPTION;
+#pragma endregion
+#pragma region Shader
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+void js_rl_shader_finalizer(JSRuntime* rt, JSValue val)
+{
+	Shader* p = (Shader*)JS_GetOpaque(val, js_rl_shader_class_id);
 
-	double value;
+	if (p)
+		UnloadShader(*p);
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+	js_free_rt(rt, p);
+}
 
-	p->m12 = value;
+JSClassDef js_rl_shader_class =
+{
+	"Shader",
+	.finalizer = js_rl_shader_finalizer,
+};
 
-	return JS_UNDEFINED;
-}
+const JSCFunctionListEntry js_rl_shader_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("id", uint, JS_RL_STRUCT_SHADER, Shader, id),
+};
 
-JSValue js_rl_matrix_set_m13(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_new_shader(JSContext* ctx, Shader shader)
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	JSValue obj = js_rl_new_resource(ctx, js_rl_shader_class_id, &shader, sizeof(Shader));
 
-	if (!p)
-		return JS_EXCEPTION;
+	if (JS_IsException(obj))
+		UnloadShader(shader);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	return obj;
+}
 
-	double value;
+#pragma endregion
+#pragma region Mesh
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+void js_rl_mesh_finalizer(JSRuntime* rt, JSValue val)
+{
+	Mesh* p = (Mesh*)JS_GetOpaque(val, js_rl_mesh_class_id);
 
-	p->m13 = value;
+	if (p)
+		UnloadMesh(p);
 
-	return JS_UNDEFINED;
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_matrix_set_m14(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_mesh_class =
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	"Mesh",
+	.finalizer = js_rl_mesh_finalizer,
+};
 
-	if (!p)
-		return JS_EXCEPTION;
+const JSCFunctionListEntry js_rl_mesh_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("vertexCount", int, JS_RL_STRUCT_MESH, Mesh, vertexCount),
+	JS_RL_READONLY_FIELD("triangleCount", int, JS_RL_STRUCT_MESH, Mesh, triangleCount),
+	JS_RL_READONLY_FIELD("vaoId", uint, JS_RL_STRUCT_MESH, Mesh, vaoId),
+};
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+JSValue js_rl_new_mesh(JSContext* ctx, Mesh mesh)
+{
+	JSValue obj = js_rl_new_resource(ctx, js_rl_mesh_class_id, &mesh, sizeof(Mesh));
 
-	double value;
+	if (JS_IsException(obj))
+		UnloadMesh(&mesh);
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+	return obj;
+}
+
+#pragma endregion
+#pragma region Model
 
-	p->m14 = value;
+void js_rl_model_finalizer(JSRuntime* rt, JSValue val)
+{
+	Model* p = (Model*)JS_GetOpaque(val, js_rl_model_class_id);
 
-	return JS_UNDEFINED;
+	if (p)
+		UnloadModel(*p);
+
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_matrix_set_m15(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_model_class =
 {
-	Matrix* p = (Matrix*)JS_GetOpaque2(ctx, this_val, js_rl_matrix_class_id);
+	"Model",
+	.finalizer = js_rl_model_finalizer,
+};
 
-	if (!p)
-		return JS_EXCEPTION;
+const JSCFunctionListEntry js_rl_model_proto_funcs[] =
+{
+	JS_RL_FIELD("transform", matrix, JS_RL_STRUCT_MODEL, Model, transform),
+	JS_RL_READONLY_FIELD("meshCount", int, JS_RL_STRUCT_MODEL, Model, meshCount),
+	JS_RL_READONLY_FIELD("materialCount", int, JS_RL_STRUCT_MODEL, Model, materialCount),
+	JS_RL_READONLY_FIELD("boneCount", int, JS_RL_STRUCT_MODEL, Model, boneCount),
+};
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+JSValue js_rl_new_model(JSContext* ctx, Model model)
+{
+	JSValue obj = js_rl_new_resource(ctx, js_rl_model_class_id, &model, sizeof(Model));
 
-	double value;
+	if (JS_IsException(obj))
+		UnloadModel(model);
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+	return obj;
+}
+
+#pragma endregion
+#pragma region Wave
 
-	p->m15 = value;
+void js_rl_wave_finalizer(JSRuntime* rt, JSValue val)
+{
+	Wave* p = (Wave*)JS_GetOpaque(val, js_rl_wave_class_id);
 
-	return JS_UNDEFINED;
+	if (p)
+		UnloadWave(*p);
+
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_new_matrix(JSContext* ctx, double m0, double m1, double m2, double m3, double m4, double m5, double m6, double m7, double m8, double m9, double m10, double m11, double m12, double m13, double m14, double m15)
+JSClassDef js_rl_wave_class =
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_matrix_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
+	"Wave",
+	.finalizer = js_rl_wave_finalizer,
+};
 
-	Matrix* p = js_mallocz(ctx, sizeof(Matrix));
+const JSCFunctionListEntry js_rl_wave_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("sampleCount", uint, JS_RL_STRUCT_WAVE, Wave, sampleCount),
+	JS_RL_READONLY_FIELD("sampleRate", uint, JS_RL_STRUCT_WAVE, Wave, sampleRate),
+	JS_RL_READONLY_FIELD("sampleSize", uint, JS_RL_STRUCT_WAVE, Wave, sampleSize),
+	JS_RL_READONLY_FIELD("channels", uint, JS_RL_STRUCT_WAVE, Wave, channels),
+};
 
-	p->m0 = m0;
-	p->m1 = m1;
-	p->m2 = m2;
-	p->m3 = m3;
-	p->m4 = m4;
-	p->m5 = m5;
-	p->m6 = m6;
-	p->m7 = m7;
-	p->m8 = m8;
-	p->m9 = m9;
-	p->m10 = m10;
-	p->m11 = m11;
-	p->m12 = m12;
-	p->m13 = m13;
-	p->m14 = m14;
-	p->m15 = m15;
+JSValue js_rl_new_wave(JSContext* ctx, Wave wave)
+{
+	JSValue obj = js_rl_new_resource(ctx, js_rl_wave_class_id, &wave, sizeof(Wave));
 
-	JS_SetOpaque(obj, p);
+	if (JS_IsException(obj))
+		UnloadWave(wave);
 
 	return obj;
 }
 
-JSValue js_rl_matrix_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+#pragma endregion
+#pragma region Sound
+
+void js_rl_sound_finalizer(JSRuntime* rt, JSValue val)
 {
-	double m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15;
+	Sound* p = (Sound*)JS_GetOpaque(val, js_rl_sound_class_id);
 
-	JS_ToFloat64(ctx, &m0, argv[0]);
-	JS_ToFloat64(ctx, &m1, argv[1]);
-	JS_ToFloat64(ctx, &m2, argv[2]);
-	JS_ToFloat64(ctx, &m3, argv[3]);
-	JS_ToFloat64(ctx, &m4, argv[4]);
-	JS_ToFloat64(ctx, &m5, argv[5]);
-	JS_ToFloat64(ctx, &m6, argv[6]);
-	JS_ToFloat64(ctx, &m7, argv[7]);
-	JS_ToFloat64(ctx, &m8, argv[8]);
-	JS_ToFloat64(ctx, &m9, argv[9]);
-	JS_ToFloat64(ctx, &m10, argv[10]);
-	JS_ToFloat64(ctx, &m11, argv[11]);
-	JS_ToFloat64(ctx, &m12, argv[12]);
-	JS_ToFloat64(ctx, &m13, argv[13]);
-	JS_ToFloat64(ctx, &m14, argv[14]);
-	JS_ToFloat64(ctx, &m15, argv[15]);
+	if (p)
+		UnloadSound(*p);
 
-	return js_rl_new_matrix(ctx, m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+	js_free_rt(rt, p);
 }
 
-const JSCFunctionListEntry js_rl_matrix_proto_funcs[] =
+JSClassDef js_rl_sound_class =
 {
-	JS_CGETSET_DEF("m0", js_rl_matrix_get_m0, js_rl_matrix_set_m0),
-	JS_CGETSET_DEF("m1", js_rl_matrix_get_m1, js_rl_matrix_set_m1),
-	JS_CGETSET_DEF("m2", js_rl_matrix_get_m2, js_rl_matrix_set_m2),
-	JS_CGETSET_DEF("m3", js_rl_matrix_get_m3, js_rl_matrix_set_m3),
-	JS_CGETSET_DEF("m4", js_rl_matrix_get_m4, js_rl_matrix_set_m4),
-	JS_CGETSET_DEF("m5", js_rl_matrix_get_m5, js_rl_matrix_set_m5),
-	JS_CGETSET_DEF("m6", js_rl_matrix_get_m6, js_rl_matrix_set_m6),
-	JS_CGETSET_DEF("m7", js_rl_matrix_get_m7, js_rl_matrix_set_m7),
-	JS_CGETSET_DEF("m8", js_rl_matrix_get_m8, js_rl_matrix_set_m8),
-	JS_CGETSET_DEF("m9", js_rl_matrix_get_m9, js_rl_matrix_set_m9),
-	JS_CGETSET_DEF("m10", js_rl_matrix_get_m10, js_rl_matrix_set_m10),
-	JS_CGETSET_DEF("m11", js_rl_matrix_get_m11, js_rl_matrix_set_m11),
-	JS_CGETSET_DEF("m12", js_rl_matrix_get_m12, js_rl_matrix_set_m12),
-	JS_CGETSET_DEF("m13", js_rl_matrix_get_m13, js_rl_matrix_set_m13),
-	JS_CGETSET_DEF("m14", js_rl_matrix_get_m14, js_rl_matrix_set_m14),
-	JS_CGETSET_DEF("m15", js_rl_matrix_get_m15, js_rl_matrix_set_m15),
+	"Sound",
+	.finalizer = js_rl_sound_finalizer,
 };
 
-void js_rl_init_matrix_class(JSContext* ctx, JSModuleDef* m)
+const JSCFunctionListEntry js_rl_sound_proto_funcs[] =
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_matrix_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_matrix_class_id, &js_rl_matrix_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_matrix_proto_funcs, countof(js_rl_matrix_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_matrix_class_id, proto);
+	JS_RL_READONLY_FIELD("source", uint, JS_RL_STRUCT_SOUND, Sound, source),
+	JS_RL_READONLY_FIELD("buffer", uint, JS_RL_STRUCT_SOUND, Sound, buffer),
+	JS_RL_READONLY_FIELD("format", int, JS_RL_STRUCT_SOUND, Sound, format),
+};
 
-	obj = JS_NewCFunction2(ctx, js_rl_matrix_constructor, "Matrix", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Matrix", obj);
+JSValue js_rl_new_sound(JSContext* ctx, Sound sound)
+{
+	JSValue obj = js_rl_new_resource(ctx, js_rl_sound_class_id, &sound, sizeof(Sound));
+
+	if (JS_IsException(obj))
+		UnloadSound(sound);
+
+	return obj;
 }
 
 #pragma endregion
-#pragma region Color
+#pragma region AudioStream
 
-JSClassDef js_rl_color_class = { "Color" };
-
-JSValue js_rl_color_get_r(JSContext* ctx, JSValueConst this_val)
+void js_rl_audio_stream_finalizer(JSRuntime* rt, JSValue val)
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
+	AudioStream* p = (AudioStream*)JS_GetOpaque(val, js_rl_audio_stream_class_id);
 
 	if (p)
-		return JS_NewInt32(ctx, p->r);
-	else
-		return JS_EXCEPTION;
+		CloseAudioStream(*p);
+
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_color_set_r(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSClassDef js_rl_audio_stream_class =
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
+	"AudioStream",
+	.finalizer = js_rl_audio_stream_finalizer,
+};
 
-	if (!p)
-		return JS_EXCEPTION;
+const JSCFunctionListEntry js_rl_audio_stream_proto_funcs[] =
+{
+	JS_RL_READONLY_FIELD("sampleRate", uint, JS_RL_STRUCT_AUDIO_STREAM, AudioStream, sampleRate),
+	JS_RL_READONLY_FIELD("sampleSize", uint, JS_RL_STRUCT_AUDIO_STREAM, AudioStream, sampleSize),
+	JS_RL_READONLY_FIELD("channels", uint, JS_RL_STRUCT_AUDIO_STREAM, AudioStream, channels),
+	JS_RL_READONLY_FIELD("format", int, JS_RL_STRUCT_AUDIO_STREAM, AudioStream, format),
+	JS_RL_READONLY_FIELD("source", uint, JS_RL_STRUCT_AUDIO_STREAM, AudioStream, source),
+};
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+JSValue js_rl_new_audio_stream(JSContext* ctx, AudioStream stream)
+{
+	JSValue obj = js_rl_new_resource(ctx, js_rl_audio_stream_class_id, &stream, sizeof(AudioStream));
 
-	int value;
+	if (JS_IsException(obj))
+		CloseAudioStream(stream);
 
-	if (JS_ToInt32(ctx, &value, v))
-		return JS_EXCEPTION;
+	return obj;
+}
 
-	p->r = value;
+#pragma endregion
 
-	return JS_UNDEFINED;
-}
+#pragma region Buffers
 
-JSValue js_rl_color_get_g(JSContext* ctx, JSValueConst this_val)
+static void js_rl_free_array_buffer(JSRuntime* rt, void* opaque, void* ptr)
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->g);
-	else
-		return JS_EXCEPTION;
+	js_free_rt(rt, ptr);
 }
 
-JSValue js_rl_color_set_g(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_new_array_buffer(JSContext* ctx, size_t size)
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
+	// Always hand out a real allocation so zero-length buffers stay attached
+	uint8_t* data = js_mallocz(ctx, max_int(size, 1));
 
-	if (!p)
+	if (!data)
 		return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	int value;
-
-	if (JS_ToInt32(ctx, &value, v))
-		return JS_EXCEPTION;
+	JSValue buffer = JS_NewArrayBuffer(ctx, data, size, js_rl_free_array_buffer, NULL, FALSE);
 
-	p->g = value;
+	if (JS_IsException(buffer))
+		js_free(ctx, data);
 
-	return JS_UNDEFINED;
+	return buffer;
 }
 
-JSValue js_rl_color_get_b(JSContext* ctx, JSValueConst this_val)
+static void js_rl_free_raylib_buffer(JSRuntime* rt, void* opaque, void* ptr)
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->b);
-	else
-		return JS_EXCEPTION;
+	free(ptr);
 }
 
-JSValue js_rl_color_set_b(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_wrap_raylib_buffer(JSContext* ctx, void* data, size_t size)
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
+	// Takes ownership of a buffer malloc'ed by raylib, released when the ArrayBuffer is collected
+	JSValue buffer = JS_NewArrayBuffer(ctx, data, size, js_rl_free_raylib_buffer, NULL, FALSE);
 
-	if (!p)
-		return JS_EXCEPTION;
+	if (JS_IsException(buffer))
+		free(data);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	return buffer;
+}
 
-	int value;
+JSValue js_rl_new_typed_array(JSContext* ctx, const char* type, JSValueConst buffer, size_t offset, size_t length)
+{
+	JSValue global = JS_GetGlobalObject(ctx);
+	JSValue ctor = JS_GetPropertyStr(ctx, global, type);
+	JS_FreeValue(ctx, global);
 
-	if (JS_ToInt32(ctx, &value, v))
-		return JS_EXCEPTION;
+	if (JS_IsException(ctor))
+		return ctor;
 
-	p->b = value;
+	JSValueConst args[3] = { buffer, JS_NewInt64(ctx, offset), JS_NewInt64(ctx, length) };
+	JSValue obj = JS_CallConstructor(ctx, ctor, 3, args);
+	JS_FreeValue(ctx, ctor);
 
-	return JS_UNDEFINED;
+	return obj;
 }
 
-JSValue js_rl_color_get_a(JSContext* ctx, JSValueConst this_val)
+int js_rl_is_typed_array(JSContext* ctx, JSValueConst val, const char* type)
 {
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
+	if (!JS_IsObject(val))
+		return 0;
 
-	if (p)
-		return JS_NewInt32(ctx, p->a);
-	else
-		return JS_EXCEPTION;
-}
+	JSValue global = JS_GetGlobalObject(ctx);
+	JSValue ctor = JS_GetPropertyStr(ctx, global, type);
+	JS_FreeValue(ctx, global);
 
-JSValue js_rl_color_set_a(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Color* p = (Color*)JS_GetOpaque2(ctx, this_val, js_rl_color_class_id);
+	if (JS_IsException(ctor))
+		return -1;
 
-	if (!p)
-		return JS_EXCEPTION;
+	int result = JS_IsInstanceOf(ctx, val, ctor);
+	JS_FreeValue(ctx, ctor);
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	return result;
+}
 
-	int value;
+uint8_t* js_rl_get_array_buffer(JSContext* ctx, JSValueConst val, size_t* size)
+{
+	size_t offset, length, bytes_per_element;
+	JSValue buffer = JS_GetTypedArrayBuffer(ctx, val, &offset, &length, &bytes_per_element);
 
-	if (JS_ToInt32(ctx, &value, v))
-		return JS_EXCEPTION;
+	if (JS_IsException(buffer))
+	{
+		// Not a typed array: fall back to a plain ArrayBuffer, which throws if it isn't one either
+		JS_FreeValue(ctx, JS_GetException(ctx));
+		return JS_GetArrayBuffer(ctx, size, val);
+	}
 
-	p->a = value;
+	size_t buffer_size;
+	uint8_t* data = JS_GetArrayBuffer(ctx, &buffer_size, buffer);
+	JS_FreeValue(ctx, buffer);
 
-	return JS_UNDEFINED;
+	if (!data)
+		return NULL;
+
+	*size = length;
+	return data + offset;
 }
 
-JSValue js_rl_new_color(JSContext* ctx, int r, int g, int b, int a)
-{
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_color_class_id);
+#pragma endregion
+#pragma region Struct arrays
 
-	if (JS_IsException(obj))
-		return obj;
+typedef struct JSRLStructArrayType
+{
+	const char* name;
+	JSClassID* class_id;
+	size_t element_size;
+	const char* view_type;
+	int components;
+} JSRLStructArrayType;
 
-	Color* p = js_mallocz(ctx, sizeof(Color));
+enum
+{
+	JS_RL_VECTOR2_ARRAY,
+	JS_RL_VECTOR3_ARRAY,
+	JS_RL_COLOR_ARRAY,
+};
 
-	p->r = r;
-	p->g = g;
-	p->b = b;
-	p->a = a;
+static const JSRLStructArrayType js_rl_struct_array_types[] =
+{
+	[JS_RL_VECTOR2_ARRAY] = { "Vector2Array", &js_rl_vector2_array_class_id, sizeof(Vector2), "Float32Array", 2 },
+	[JS_RL_VECTOR3_ARRAY] = { "Vector3Array", &js_rl_vector3_array_class_id, sizeof(Vector3), "Float32Array", 3 },
+	[JS_RL_COLOR_ARRAY] = { "ColorArray", &js_rl_color_array_class_id, sizeof(Color), "Uint8Array", 4 },
+};
 
-	JS_SetOpaque(obj, p);
+static void js_rl_struct_array_finalize(JSRuntime* rt, JSRLStructArray* p)
+{
+	if (!p)
+		return;
 
-	return obj;
+	JS_FreeValueRT(rt, p->buffer);
+	JS_FreeValueRT(rt, p->view);
+	js_free_rt(rt, p);
 }
 
-JSValue js_rl_color_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+static void js_rl_struct_array_mark(JSRuntime* rt, JSRLStructArray* p, JS_MarkFunc* mark_func)
 {
-	int r, g, b, a;
-
-	if (JS_ToInt32(ctx, &r, argv[0]))
-		return JS_EXCEPTION;
-
-	if (JS_ToInt32(ctx, &g, argv[1]))
-		return JS_EXCEPTION;
+	if (!p)
+		return;
 
-	if (JS_ToInt32(ctx, &b, argv[2]))
-		return JS_EXCEPTION;
+	JS_MarkValue(rt, p->buffer, mark_func);
+	JS_MarkValue(rt, p->view, mark_func);
+}
 
-	if (JS_IsUndefined(argv[3]))
-		a = 255;
-	else if (JS_ToInt32(ctx, &a, argv[3]))
-		return JS_EXCEPTION;
+void js_rl_vector2_array_finalizer(JSRuntime* rt, JSValue val)
+{
+	js_rl_struct_array_finalize(rt, JS_GetOpaque(val, js_rl_vector2_array_class_id));
+}
 
-	return js_rl_new_color(ctx, r, g, b, a);
+static void js_rl_vector2_array_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
+{
+	js_rl_struct_array_mark(rt, JS_GetOpaque(val, js_rl_vector2_array_class_id), mark_func);
 }
 
-const JSCFunctionListEntry js_rl_color_proto_funcs[] =
+void js_rl_vector3_array_finalizer(JSRuntime* rt, JSValue val)
 {
-	JS_CGETSET_DEF("r", js_rl_color_get_r, js_rl_color_set_r),
-	JS_CGETSET_DEF("g", js_rl_color_get_g, js_rl_color_set_g),
-	JS_CGETSET_DEF("b", js_rl_color_get_b, js_rl_color_set_b),
-	JS_CGETSET_DEF("a", js_rl_color_get_a, js_rl_color_set_a),
-};
+	js_rl_struct_array_finalize(rt, JS_GetOpaque(val, js_rl_vector3_array_class_id));
+}
 
-void js_rl_init_color_class(JSContext* ctx, JSModuleDef* m)
+static void js_rl_vector3_array_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_color_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_color_class_id, &js_rl_color_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_color_proto_funcs, countof(js_rl_color_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_color_class_id, proto);
+	js_rl_struct_array_mark(rt, JS_GetOpaque(val, js_rl_vector3_array_class_id), mark_func);
+}
 
-	obj = JS_NewCFunction2(ctx, js_rl_color_constructor, "Color", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Color", obj);
+void js_rl_color_array_finalizer(JSRuntime* rt, JSValue val)
+{
+	js_rl_struct_array_finalize(rt, JS_GetOpaque(val, js_rl_color_array_class_id));
 }
 
-#pragma endregion
-#pragma region Rectangle
+static void js_rl_color_array_mark(JSRuntime* rt, JSValueConst val, JS_MarkFunc* mark_func)
+{
+	js_rl_struct_array_mark(rt, JS_GetOpaque(val, js_rl_color_array_class_id), mark_func);
+}
 
-JSClassDef js_rl_rectangle_class = { "Rectangle" };
+JSClassDef js_rl_vector2_array_class =
+{
+	"Vector2Array",
+	.finalizer = js_rl_vector2_array_finalizer,
+	.gc_mark = js_rl_vector2_array_mark,
+};
 
-JSValue js_rl_rectangle_get_x(JSContext* ctx, JSValueConst this_val)
+JSClassDef js_rl_vector3_array_class =
 {
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+	"Vector3Array",
+	.finalizer = js_rl_vector3_array_finalizer,
+	.gc_mark = js_rl_vector3_array_mark,
+};
 
-	if (p)
-		return JS_NewFloat64(ctx, p->x);
-	else
-		return JS_EXCEPTION;
-}
+JSClassDef js_rl_color_array_class =
+{
+	"ColorArray",
+	.finalizer = js_rl_color_array_finalizer,
+	.gc_mark = js_rl_color_array_mark,
+};
 
-JSValue js_rl_rectangle_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+void* js_rl_get_struct_array(JSContext* ctx, JSValueConst val, JSClassID class_id, uint32_t* length)
 {
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+	JSRLStructArray* p = (JSRLStructArray*)JS_GetOpaque2(ctx, val, class_id);
 
 	if (!p)
-		return JS_EXCEPTION;
+		return NULL;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	// The buffer is resolved on every call so a detached ArrayBuffer throws instead of dangling
+	size_t size;
+	uint8_t* data = JS_GetArrayBuffer(ctx, &size, p->buffer);
 
-	double value;
+	if (!data)
+		return NULL;
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+	if (p->offset + (size_t)p->length * p->element_size > size)
+	{
+		JS_ThrowRangeError(ctx, "struct array is out of bounds of its buffer");
+		return NULL;
+	}
 
-	p->x = value;
+	*length = p->length;
 
-	return JS_UNDEFINED;
+	return data + p->offset;
 }
 
-JSValue js_rl_rectangle_get_y(JSContext* ctx, JSValueConst this_val)
+// Copies one struct object into a packed slot
+static int js_rl_struct_array_write(JSContext* ctx, int kind, uint8_t* slot, JSValueConst value)
 {
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+	const JSRLStructArrayType* type = &js_rl_struct_array_types[kind];
+	JSClassID element_class_id = kind == JS_RL_VECTOR2_ARRAY ? js_rl_vector2_class_id : kind == JS_RL_VECTOR3_ARRAY ? js_rl_vector3_class_id : js_rl_color_class_id;
+	void* element = JS_GetOpaque2(ctx, value, element_class_id);
 
-	if (p)
-		return JS_NewFloat64(ctx, p->y);
-	else
-		return JS_EXCEPTION;
+	if (!element)
+		return -1;
+
+	memcpy(slot, element, type->element_size);
+
+	return 0;
 }
 
-JSValue js_rl_rectangle_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+static JSValue js_rl_struct_array_constructor(JSContext* ctx, int kind, int argc, JSValueConst* argv)
 {
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+	const JSRLStructArrayType* type = &js_rl_struct_array_types[kind];
+	JSValue buffer;
+	size_t offset = 0;
+	uint32_t length;
 
-	if (!p)
-		return JS_EXCEPTION;
+	if (JS_IsNumber(argv[0]))
+	{
+		if (JS_RL_TO_UINT32(ctx, &length, argv[0]))
+			return JS_EXCEPTION;
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+		buffer = js_rl_new_array_buffer(ctx, (size_t)length * type->element_size);
 
-	double value;
+		if (JS_IsException(buffer))
+			return buffer;
+	}
+	else if (JS_IsArray(ctx, argv[0]))
+	{
+		JSValue len = JS_GetProperty(ctx, argv[0], JS_ATOM_length);
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+		if (JS_RL_TO_UINT32(ctx, &length, len))
+		{
+			JS_FreeValue(ctx, len);
+			return JS_EXCEPTION;
+		}
 
-	p->y = value;
+		JS_FreeValue(ctx, len);
 
-	return JS_UNDEFINED;
-}
+		buffer = js_rl_new_array_buffer(ctx, (size_t)length * type->element_size);
 
-JSValue js_rl_rectangle_get_width(JSContext* ctx, JSValueConst this_val)
-{
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+		if (JS_IsException(buffer))
+			return buffer;
 
-	if (p)
-		return JS_NewFloat64(ctx, p->width);
+		size_t size;
+		uint8_t* data = JS_GetArrayBuffer(ctx, &size, buffer);
+
+		for (uint32_t i = 0; i < length; i++)
+		{
+			JSValue value = JS_GetPropertyUint32(ctx, argv[0], i);
+			int ret = js_rl_struct_array_write(ctx, kind, data + i * type->element_size, value);
+			JS_FreeValue(ctx, value);
+
+			if (ret)
+			{
+				JS_FreeValue(ctx, buffer);
+				return JS_EXCEPTION;
+			}
+		}
+	}
 	else
-		return JS_EXCEPTION;
-}
+	{
+		// Wrap an existing ArrayBuffer or typed array without copying
+		size_t byte_length, bytes_per_element;
+		buffer = JS_GetTypedArrayBuffer(ctx, argv[0], &offset, &byte_length, &bytes_per_element);
 
-JSValue js_rl_rectangle_set_width(JSContext* ctx, JSValueConst this_val, JSValueConst v)
-{
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+		if (JS_IsException(buffer))
+		{
+			JS_FreeValue(ctx, JS_GetException(ctx));
+
+			if (!JS_GetArrayBuffer(ctx, &byte_length, argv[0]))
+				return JS_EXCEPTION;
+
+			buffer = JS_DupValue(ctx, argv[0]);
+			offset = 0;
+		}
+
+		if (byte_length % type->element_size || offset % sizeof(float))
+		{
+			JS_FreeValue(ctx, buffer);
+			return JS_ThrowRangeError(ctx, "%s buffer must be aligned to whole elements", type->name);
+		}
+
+		length = byte_length / type->element_size;
+	}
+
+	JSValue obj = JS_NewObjectClass(ctx, *type->class_id);
+
+	if (JS_IsException(obj))
+	{
+		JS_FreeValue(ctx, buffer);
+		return obj;
+	}
+
+	JSRLStructArray* p = js_mallocz(ctx, sizeof(JSRLStructArray));
 
 	if (!p)
+	{
+		JS_FreeValue(ctx, buffer);
+		JS_FreeValue(ctx, obj);
 		return JS_EXCEPTION;
+	}
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
+	p->buffer = buffer;
+	p->view = JS_UNDEFINED;
+	p->offset = offset;
+	p->length = length;
+	p->element_size = type->element_size;
 
-	double value;
+	JS_SetOpaque(obj, p);
 
-	if (JS_ToFloat64(ctx, &value, v))
-		return JS_EXCEPTION;
+	return obj;
+}
 
-	p->width = value;
+JSValue js_rl_vector2_array_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+{
+	return js_rl_struct_array_constructor(ctx, JS_RL_VECTOR2_ARRAY, argc, argv);
+}
 
-	return JS_UNDEFINED;
+JSValue js_rl_vector3_array_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+{
+	return js_rl_struct_array_constructor(ctx, JS_RL_VECTOR3_ARRAY, argc, argv);
 }
 
-JSValue js_rl_rectangle_get_height(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_color_array_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
 {
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+	return js_rl_struct_array_constructor(ctx, JS_RL_COLOR_ARRAY, argc, argv);
+}
+
+JSValue js_rl_struct_array_get_length(JSContext* ctx, JSValueConst this_val, int magic)
+{
+	JSRLStructArray* p = (JSRLStructArray*)JS_GetOpaque2(ctx, this_val, *js_rl_struct_array_types[magic].class_id);
 
 	if (p)
-		return JS_NewFloat64(ctx, p->height);
+		return JS_NewUint32(ctx, p->length);
 	else
 		return JS_EXCEPTION;
 }
 
-JSValue js_rl_rectangle_set_height(JSContext* ctx, JSValueConst this_val, JSValueConst v)
+JSValue js_rl_struct_array_get_buffer(JSContext* ctx, JSValueConst this_val, int magic)
 {
-	Rectangle* p = (Rectangle*)JS_GetOpaque2(ctx, this_val, js_rl_rectangle_class_id);
+	JSRLStructArray* p = (JSRLStructArray*)JS_GetOpaque2(ctx, this_val, *js_rl_struct_array_types[magic].class_id);
 
-	if (!p)
+	if (p)
+		return JS_DupValue(ctx, p->buffer);
+	else
 		return JS_EXCEPTION;
+}
 
-	if (JS_IsUndefined(this_val) || JS_IsNull(this_val))
-		return JS_UNDEFINED;
-	if (JS_IsNull(v))
-		return JS_UNDEFINED;
-
-	double value;
+JSValue js_rl_struct_array_get_data(JSContext* ctx, JSValueConst this_val, int magic)
+{
+	const JSRLStructArrayType* type = &js_rl_struct_array_types[magic];
+	JSRLStructArray* p = (JSRLStructArray*)JS_GetOpaque2(ctx, this_val, *type->class_id);
 
-	if (JS_ToFloat64(ctx, &value, v))
+	if (!p)
 		return JS_EXCEPTION;
 
-	p->height = value;
+	// The view is created on first access and shared afterwards
+	if (JS_IsUndefined(p->view))
+	{
+		p->view = js_rl_new_typed_array(ctx, type->view_type, p->buffer, p->offset, (size_t)p->length * type->components);
 
-	return JS_UNDEFINED;
+		if (JS_IsException(p->view))
+		{
+			p->view = JS_UNDEFINED;
+			return JS_EXCEPTION;
+		}
+	}
+
+	return JS_DupValue(ctx, p->view);
 }
 
-JSValue js_rl_new_rectangle(JSContext* ctx, double x, double y, double w, double h)
+static uint8_t* js_rl_struct_array_at(JSContext* ctx, JSValueConst this_val, int kind, JSValueConst index)
 {
-	JSValue obj = JS_NewObjectClass(ctx, js_rl_rectangle_class_id);
-
-	if (JS_IsException(obj))
-		return obj;
+	const JSRLStructArrayType* type = &js_rl_struct_array_types[kind];
+	uint32_t length, i;
+	uint8_t* data = js_rl_get_struct_array(ctx, this_val, *type->class_id, &length);
 
-	Rectangle* p = js_mallocz(ctx, sizeof(Rectangle));
+	if (!data)
+		return NULL;
 
-	p->x = x;
-	p->y = y;
-	p->width = w;
-	p->height = h;
+	if (JS_RL_TO_UINT32(ctx, &i, index))
+		return NULL;
 
-	JS_SetOpaque(obj, p);
+	if (i >= length)
+	{
+		JS_ThrowRangeError(ctx, "%s index %u is out of range", type->name, i);
+		return NULL;
+	}
 
-	return obj;
+	return data + i * type->element_size;
 }
 
-JSValue js_rl_rectangle_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv)
+JSValue js_rl_struct_array_get(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic)
 {
-	double x, y, w, h;
+	uint8_t* slot = js_rl_struct_array_at(ctx, this_val, magic, argv[0]);
 
-	if (JS_ToFloat64(ctx, &x, argv[0]))
+	if (!slot)
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &y, argv[1]))
-		return JS_EXCEPTION;
+	switch (magic)
+	{
+		case JS_RL_VECTOR2_ARRAY:
+		{
+			Vector2* v = (Vector2*)slot;
+			return js_rl_new_vector2(ctx, v->x, v->y);
+		}
+		case JS_RL_VECTOR3_ARRAY:
+		{
+			Vector3* v = (Vector3*)slot;
+			return js_rl_new_vector3(ctx, v->x, v->y, v->z);
+		}
+		default:
+		{
+			Color* c = (Color*)slot;
+			return js_rl_new_color(ctx, c->r, c->g, c->b, c->a);
+		}
+	}
+}
+
+JSValue js_rl_struct_array_set(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic)
+{
+	uint8_t* slot = js_rl_struct_array_at(ctx, this_val, magic, argv[0]);
 
-	if (JS_ToFloat64(ctx, &w, argv[2]))
+	if (!slot)
 		return JS_EXCEPTION;
 
-	if (JS_ToFloat64(ctx, &h, argv[3]))
+	if (js_rl_struct_array_write(ctx, magic, slot, argv[1]))
 		return JS_EXCEPTION;
 
-	return js_rl_new_rectangle(ctx, x, y, w, h);
+	return JS_UNDEFINED;
 }
 
-const JSCFunctionListEntry js_rl_rectangle_proto_funcs[] =
+#define JS_RL_STRUCT_ARRAY_PROTO_FUNCS(kind) \
+	JS_CGETSET_MAGIC_DEF("length", js_rl_struct_array_get_length, NULL, kind), \
+	JS_CGETSET_MAGIC_DEF("buffer", js_rl_struct_array_get_buffer, NULL, kind), \
+	JS_CGETSET_MAGIC_DEF("data", js_rl_struct_array_get_data, NULL, kind), \
+	JS_CFUNC_MAGIC_DEF("get", 1, js_rl_struct_array_get, kind), \
+	JS_CFUNC_MAGIC_DEF("set", 2, js_rl_struct_array_set, kind)
+
+const JSCFunctionListEntry js_rl_vector2_array_proto_funcs[] =
 {
-	JS_CGETSET_DEF("x", js_rl_rectangle_get_x, js_rl_rectangle_set_x),
-	JS_CGETSET_DEF("y", js_rl_rectangle_get_y, js_rl_rectangle_set_y),
-	JS_CGETSET_DEF("width", js_rl_rectangle_get_width, js_rl_rectangle_set_width),
-	JS_CGETSET_DEF("height", js_rl_rectangle_get_height, js_rl_rectangle_set_height),
+	JS_RL_STRUCT_ARRAY_PROTO_FUNCS(JS_RL_VECTOR2_ARRAY),
 };
 
-void js_rl_init_rectangle_class(JSContext* ctx, JSModuleDef* m)
+const JSCFunctionListEntry js_rl_vector3_array_proto_funcs[] =
 {
-	JSValue proto, obj;
-	JS_NewClassID(&js_rl_rectangle_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_rectangle_class_id, &js_rl_rectangle_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_rectangle_proto_funcs, countof(js_rl_rectangle_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_rectangle_class_id, proto);
-
-	obj = JS_NewCFunction2(ctx, js_rl_rectangle_constructor, "Rectangle", 4, JS_CFUNC_constructor_or_func, 0);
-	JS_SetModuleExport(ctx, m, "Rectangle", obj);
-}
-
-#pragma endregion
-#pragma region CharInfo
-
-JSClassDef js_rl_char_info_class = { "CharInfo" };
+	JS_RL_STRUCT_ARRAY_PROTO_FUNCS(JS_RL_VECTOR3_ARRAY),
+};
 
-JSValue js_rl_char_info_get_value(JSContext* ctx, JSValueConst this_val)
+const JSCFunctionListEntry js_rl_color_array_proto_funcs[] =
 {
-	CharInfo* p = (CharInfo*)JS_GetOpaque2(ctx, this_val, js_rl_char_info_class_id);
-
-	if (p)
-		return JS_NewInt32(ctx, p->value);
-	else
-		return JS_EXCEPTION;
-}
+	JS_RL_STRUCT_ARRAY_PROTO_FUNCS(JS_RL_COLOR_ARRAY),
+};
 
-JSValue js_rl_char_info_get_offset_x(JSContext* ctx, JSValueConst this_val)
+void js_rl_init_vector2_array_class(JSContext* ctx, JSModuleDef* m)
 {
-	CharInfo* p = (CharInfo*)JS_GetOpaque2(ctx, this_val, js_rl_char_info_class_id);
+	JSValue proto, obj;
+	JS_NewClassID(&js_rl_vector2_array_class_id);
+	JS_NewClass(JS_GetRuntime(ctx), js_rl_vector2_array_class_id, &js_rl_vector2_array_class);
+	proto = JS_NewObject(ctx);
+	JS_SetPropertyFunctionList(ctx, proto, js_rl_vector2_array_proto_funcs, countof(js_rl_vector2_array_proto_funcs));
+	JS_SetClassProto(ctx, js_rl_vector2_array_class_id, proto);
 
-	if (p)
-		return JS_NewInt32(ctx, p->offsetX);
-	else
-		return JS_EXCEPTION;
+	obj = JS_NewCFunction2(ctx, js_rl_vector2_array_constructor, "Vector2Array", 1, JS_CFUNC_constructor_or_func, 0);
+	JS_SetModuleExport(ctx, m, "Vector2Array", obj);
 }
 
-JSValue js_rl_char_info_get_offset_y(JSContext* ctx, JSValueConst this_val)
+void js_rl_init_vector3_array_class(JSContext* ctx, JSModuleDef* m)
 {
-	CharInfo* p = (CharInfo*)JS_GetOpaque2(ctx, this_val, js_rl_char_info_class_id);
+	JSValue proto, obj;
+	JS_NewClassID(&js_rl_vector3_array_class_id);
+	JS_NewClass(JS_GetRuntime(ctx), js_rl_vector3_array_class_id, &js_rl_vector3_array_class);
+	proto = JS_NewObject(ctx);
+	JS_SetPropertyFunctionList(ctx, proto, js_rl_vector3_array_proto_funcs, countof(js_rl_vector3_array_proto_funcs));
+	JS_SetClassProto(ctx, js_rl_vector3_array_class_id, proto);
 
-	if (p)
-		return JS_NewInt32(ctx, p->offsetY);
-	else
-		return JS_EXCEPTION;
+	obj = JS_NewCFunction2(ctx, js_rl_vector3_array_constructor, "Vector3Array", 1, JS_CFUNC_constructor_or_func, 0);
+	JS_SetModuleExport(ctx, m, "Vector3Array", obj);
 }
 
-JSValue js_rl_char_info_get_advance_x(JSContext* ctx, JSValueConst this_val)
+void js_rl_init_color_array_class(JSContext* ctx, JSModuleDef* m)
 {
-	CharInfo* p = (CharInfo*)JS_GetOpaque2(ctx, this_val, js_rl_char_info_class_id);
+	JSValue proto, obj;
+	JS_NewClassID(&js_rl_color_array_class_id);
+	JS_NewClass(JS_GetRuntime(ctx), js_rl_color_array_class_id, &js_rl_color_array_class);
+	proto = JS_NewObject(ctx);
+	JS_SetPropertyFunctionList(ctx, proto, js_rl_color_array_proto_funcs, countof(js_rl_color_array_proto_funcs));
+	JS_SetClassProto(ctx, js_rl_color_array_class_id, proto);
 
-	if (p)
-		return JS_NewInt32(ctx, p->advanceX);
-	else
-		return JS_EXCEPTION;
+	obj = JS_NewCFunction2(ctx, js_rl_color_array_constructor, "ColorArray", 1, JS_CFUNC_constructor_or_func, 0);
+	JS_SetModuleExport(ctx, m, "ColorArray", obj);
 }
 
-JSValue js_rl_char_info_get_image(JSContext* ctx, JSValueConst this_val)
-{
-	CharInfo* p = (CharInfo*)JS_GetOpaque2(ctx, this_val, js_rl_char_info_class_id);
-
-	if (p)
-	{
-		JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
+#pragma endregion
 
-		if (JS_IsException(obj))
-			return obj;
+#pragma region Struct results
 
-		JS_SetOpaque(obj, &p->image);
+JSValue js_rl_new_struct(JSContext* ctx, JSRLPoolKind kind, const void* value)
+{
+	JSValue obj = JS_NewObjectClass(ctx, *js_rl_pooled_classes[kind].class_id);
 
+	if (JS_IsException(obj))
 		return obj;
-	}
-	else
-		return JS_EXCEPTION;
-}
 
-const JSCFunctionListEntry js_rl_char_info_proto_funcs[] =
-{
-	JS_CGETSET_DEF("value", js_rl_char_info_get_value, NULL),
-	JS_CGETSET_DEF("offsetX", js_rl_char_info_get_offset_x, NULL),
-	JS_CGETSET_DEF("offsetY", js_rl_char_info_get_offset_y, NULL),
-	JS_CGETSET_DEF("advanceX", js_rl_char_info_get_advance_x, NULL),
-	JS_CGETSET_DEF("image", js_rl_char_info_get_image, NULL),
-};
+	void* p = js_rl_pool_alloc(ctx, kind);
 
-void js_rl_init_char_info_class(JSContext* ctx, JSModuleDef* m)
-{
-	JSValue proto;
-	JS_NewClassID(&js_rl_char_info_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_char_info_class_id, &js_rl_char_info_class);
-	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_char_info_proto_funcs, countof(js_rl_char_info_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_char_info_class_id, proto);
-	// JS_NewCFunction2(ctx, js_rl_char_info_constructor, "CharInfo", 1, JS_CFUNC_constructor_or_func, 0);
-}
+	if (!p)
+	{
+		JS_FreeValue(ctx, obj);
+		return JS_EXCEPTION;
+	}
 
-#pragma endregion
-#pragma region Font
+	memcpy(p, value, js_rl_pooled_classes[kind].size);
+	JS_SetOpaque(obj, p);
 
-void js_rl_font_finalizer(JSRuntime* rt, JSValue val)
-{
-	Font* p = (Font*)JS_GetOpaque(val, js_rl_font_class_id);
-	UnloadFont(*p);
+	return obj;
 }
 
-JSClassDef js_rl_font_class =
+JSValue js_rl_return_struct(JSContext* ctx, JSRLPoolKind kind, const void* value, int argc, JSValueConst* argv, int index)
 {
-	"Font",
-	.finalizer = js_rl_font_finalizer,
-};
+	if (index >= argc || JS_IsUndefined(argv[index]))
+		return js_rl_new_struct(ctx, kind, value);
 
-JSValue js_rl_font_get_texture(JSContext* ctx, JSValueConst this_val)
-{
-	Font* p = (Font*)JS_GetOpaque2(ctx, this_val, js_rl_font_class_id);
+	JSValueConst dest = argv[index];
+	size_t size = js_rl_pooled_classes[kind].size;
+	void* p = JS_GetOpaque(dest, *js_rl_pooled_classes[kind].class_id);
 
 	if (p)
 	{
-		JSValue obj = JS_NewObjectClass(ctx, js_rl_image_class_id);
-		Texture2D* p2 = js_mallocz(ctx, sizeof(Texture2D));
+		memcpy(p, value, size);
+		return JS_DupValue(ctx, dest);
+	}
 
-		if (!p2) {
-			JS_FreeValue(ctx, obj);
-			return JS_EXCEPTION;
-		}
+	// Otherwise the fields are written into a typed array, starting at an
+	// optional element offset given right after it
+	size_t element_size = js_rl_pooled_classes[kind].element_size;
+	size_t offset, length, bytes_per_element;
+	JSValue buffer = JS_GetTypedArrayBuffer(ctx, dest, &offset, &length, &bytes_per_element);
 
-		memcpy(p2, &p->texture, sizeof(Texture2D));
-		JS_SetOpaque(obj, p);
+	if (JS_IsException(buffer))
+		return buffer;
 
-		return obj;
+	if (bytes_per_element != element_size)
+	{
+		JS_FreeValue(ctx, buffer);
+		return JS_ThrowTypeError(ctx, "destination must be an object of the result class or a typed array of %zu-byte elements", element_size);
 	}
-	else
+
+	uint32_t start = 0;
+
+	if (index + 1 < argc && !JS_IsUndefined(argv[index + 1]) && JS_RL_TO_UINT32(ctx, &start, argv[index + 1]))
+	{
+		JS_FreeValue(ctx, buffer);
 		return JS_EXCEPTION;
-}
+	}
 
-JSValue js_rl_font_get_base_size(JSContext* ctx, JSValueConst this_val)
-{
-	Font* p = (Font*)JS_GetOpaque2(ctx, this_val, js_rl_font_class_id);
+	size_t buffer_size;
+	uint8_t* data = JS_GetArrayBuffer(ctx, &buffer_size, buffer);
+	JS_FreeValue(ctx, buffer);
 
-	if (p)
-		return JS_NewInt32(ctx, p->baseSize);
-	else
+	if (!data)
 		return JS_EXCEPTION;
+
+	if ((size_t)start * element_size + size > length)
+		return JS_ThrowRangeError(ctx, "destination offset %u is out of range", start);
+
+	memcpy(data + offset + (size_t)start * element_size, value, size);
+
+	return JS_DupValue(ctx, dest);
 }
 
-JSValue js_rl_font_get_chars(JSContext* ctx, JSValueConst this_val)
+JSValue js_rl_persist(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
 {
-	Font* p = (Font*)JS_GetOpaque2(ctx, this_val, js_rl_font_class_id);
-
-	if (p)
+	for (int i = 0; i < countof(js_rl_pooled_classes); i++)
 	{
-		JSValue arr = JS_NewArray(ctx);
+		void* p = JS_GetOpaque(argv[0], *js_rl_pooled_classes[i].class_id);
 
-		for (int i = 0; i < p->charsCount; i++)
-		{
-			JSValue obj = JS_NewObjectClass(ctx, js_rl_char_info_class_id);
-			CharInfo* character = js_mallocz(ctx, sizeof(CharInfo));
-			memcpy(character, p->chars + i, sizeof(Color));
-			JS_SetOpaque(obj, character);
-			JS_SetPropertyInt64(ctx, arr, i, obj);
-		}
+		if (!p)
+			continue;
 
-		return arr;
+		// Moves the payload out of the frame arena, the object itself is unchanged
+		void* copy = js_rl_pool_persist(ctx, js_rl_pooled_classes[i].kind, p);
+
+		if (!copy)
+			return JS_EXCEPTION;
+
+		if (copy != p)
+			JS_SetOpaque(argv[0], copy);
+
+		break;
 	}
-	else
-		return JS_EXCEPTION;
+
+	return JS_DupValue(ctx, argv[0]);
 }
 
-const JSCFunctionListEntry js_rl_font_proto_funcs[] =
-{
-	JS_CGETSET_DEF("texture", js_rl_font_get_texture, NULL),
-	JS_CGETSET_DEF("baseSize", js_rl_font_get_base_size, NULL),
-	JS_CGETSET_DEF("chars", js_rl_font_get_chars, NULL),
+#pragma endregion
+
+#pragma region Struct classes
+
+static const JSRLStructClassDef js_rl_struct_classes[JS_RL_STRUCT_COUNT] =
+{
+	[JS_RL_STRUCT_IMAGE] = { &js_rl_image_class_id, &js_rl_image_class, js_rl_image_proto_funcs, countof(js_rl_image_proto_funcs) },
+	[JS_RL_STRUCT_VECTOR2] = { &js_rl_vector2_class_id, &js_rl_vector2_class, js_rl_vector2_proto_funcs, countof(js_rl_vector2_proto_funcs), js_rl_vector2_constructor, 2 },
+	[JS_RL_STRUCT_VECTOR3] = { &js_rl_vector3_class_id, &js_rl_vector3_class, js_rl_vector3_proto_funcs, countof(js_rl_vector3_proto_funcs), js_rl_vector3_constructor, 3 },
+	[JS_RL_STRUCT_VECTOR4] = { &js_rl_vector4_class_id, &js_rl_vector4_class, js_rl_vector4_proto_funcs, countof(js_rl_vector4_proto_funcs), js_rl_vector4_constructor, 4 },
+	[JS_RL_STRUCT_CAMERA2D] = { &js_rl_camera2d_class_id, &js_rl_camera2d_class, js_rl_camera2d_proto_funcs, countof(js_rl_camera2d_proto_funcs), js_rl_camera2d_constructor, 4 },
+	[JS_RL_STRUCT_CAMERA3D] = { &js_rl_camera3d_class_id, &js_rl_camera3d_class, js_rl_camera3d_proto_funcs, countof(js_rl_camera3d_proto_funcs), js_rl_camera3d_constructor, 5 },
+	[JS_RL_STRUCT_TEXTURE2D] = { &js_rl_texture2d_class_id, &js_rl_texture2d_class, js_rl_texture2d_proto_funcs, countof(js_rl_texture2d_proto_funcs) },
+	[JS_RL_STRUCT_RENDER_TEXTURE] = { &js_rl_render_texture_class_id, &js_rl_render_texture_class, js_rl_render_texture_proto_funcs, countof(js_rl_render_texture_proto_funcs), js_rl_render_texture_constructor, 2 },
+	[JS_RL_STRUCT_RAY] = { &js_rl_ray_class_id, &js_rl_ray_class, js_rl_ray_proto_funcs, countof(js_rl_ray_proto_funcs), js_rl_ray_constructor, 2 },
+	[JS_RL_STRUCT_COLOR] = { &js_rl_color_class_id, &js_rl_color_class, js_rl_color_proto_funcs, countof(js_rl_color_proto_funcs), js_rl_color_constructor, 4 },
+	[JS_RL_STRUCT_MATRIX] = { &js_rl_matrix_class_id, &js_rl_matrix_class, js_rl_matrix_proto_funcs, countof(js_rl_matrix_proto_funcs), js_rl_matrix_constructor, 16 },
+	[JS_RL_STRUCT_RECTANGLE] = { &js_rl_rectangle_class_id, &js_rl_rectangle_class, js_rl_rectangle_proto_funcs, countof(js_rl_rectangle_proto_funcs), js_rl_rectangle_constructor, 4 },
+	[JS_RL_STRUCT_FONT] = { &js_rl_font_class_id, &js_rl_font_class, js_rl_font_proto_funcs, countof(js_rl_font_proto_funcs) },
+	[JS_RL_STRUCT_CHAR_INFO] = { &js_rl_char_info_class_id, &js_rl_char_info_class, js_rl_char_info_proto_funcs, countof(js_rl_char_info_proto_funcs) },
+	[JS_RL_STRUCT_SHADER] = { &js_rl_shader_class_id, &js_rl_shader_class, js_rl_shader_proto_funcs, countof(js_rl_shader_proto_funcs) },
+	[JS_RL_STRUCT_MESH] = { &js_rl_mesh_class_id, &js_rl_mesh_class, js_rl_mesh_proto_funcs, countof(js_rl_mesh_proto_funcs) },
+	[JS_RL_STRUCT_MODEL] = { &js_rl_model_class_id, &js_rl_model_class, js_rl_model_proto_funcs, countof(js_rl_model_proto_funcs) },
+	[JS_RL_STRUCT_WAVE] = { &js_rl_wave_class_id, &js_rl_wave_class, js_rl_wave_proto_funcs, countof(js_rl_wave_proto_funcs) },
+	[JS_RL_STRUCT_SOUND] = { &js_rl_sound_class_id, &js_rl_sound_class, js_rl_sound_proto_funcs, countof(js_rl_sound_proto_funcs) },
+	[JS_RL_STRUCT_AUDIO_STREAM] = { &js_rl_audio_stream_class_id, &js_rl_audio_stream_class, js_rl_audio_stream_proto_funcs, countof(js_rl_audio_stream_proto_funcs) },
 };
 
-void js_rl_init_font_class(JSContext* ctx, JSModuleDef* m)
+static void js_rl_init_struct_class(JSContext* ctx, JSModuleDef* m, const JSRLStructClassDef* def)
 {
-	JSValue proto;
-	JS_NewClassID(&js_rl_font_class_id);
-	JS_NewClass(JS_GetRuntime(ctx), js_rl_font_class_id, &js_rl_font_class);
+	JSValue proto, obj;
+	JS_NewClassID(def->class_id);
+	JS_NewClass(JS_GetRuntime(ctx), *def->class_id, def->class_def);
 	proto = JS_NewObject(ctx);
-	JS_SetPropertyFunctionList(ctx, proto, js_rl_font_proto_funcs, countof(js_rl_font_proto_funcs));
-	JS_SetClassProto(ctx, js_rl_font_class_id, proto);
-	// JS_NewCFunction2(ctx, js_rl_font_constructor, "Font", 1, JS_CFUNC_constructor_or_func, 0);
+	JS_SetPropertyFunctionList(ctx, proto, def->fields, def->field_count);
+	JS_SetClassProto(ctx, *def->class_id, proto);
+
+	if (!def->constructor)
+		return;
+
+	obj = JS_NewCFunction2(ctx, def->constructor, def->class_def->class_name, def->length, JS_CFUNC_constructor_or_func, 0);
+	JS_SetModuleExport(ctx, m, def->class_def->class_name, obj);
 }
 
 #pragma endregion
 
 void js_rl_init_classes(JSContext* ctx, JSModuleDef* m)
 {
-	js_rl_init_image_class(ctx, m);
-	js_rl_init_vector2_class(ctx, m);
-	js_rl_init_vector3_class(ctx, m);
-	js_rl_init_vector4_class(ctx, m);
-	js_rl_init_camera2d_class(ctx, m);
-	js_rl_init_camera3d_class(ctx, m);
-	js_rl_init_texture2d_class(ctx, m);
-	js_rl_init_render_texture_class(ctx, m);
-	js_rl_init_ray_class(ctx, m);
-	js_rl_init_color_class(ctx, m);
-	js_rl_init_matrix_class(ctx, m);
-	js_rl_init_rectangle_class(ctx, m);
-	js_rl_init_font_class(ctx, m);
-	js_rl_init_char_info_class(ctx, m);
+	for (int i = 0; i < JS_RL_STRUCT_COUNT; i++)
+		js_rl_init_struct_class(ctx, m, &js_rl_struct_classes[i]);
+
+	js_rl_init_vector2_array_class(ctx, m);
+	js_rl_init_vector3_array_class(ctx, m);
+	js_rl_init_color_array_class(ctx, m);
+	js_rl_init_display_list_class(ctx, m);
 }
 
 void js_rl_init_module_classes(JSContext* ctx, JSModuleDef* m)
@@ -2512,4 +2220,8 @@ void js_rl_init_module_classes(JSContext* ctx, JSModuleDef* m)
 	JS_AddModuleExport(ctx, m, "Rectangle");
 	JS_AddModuleExport(ctx, m, "Font");
 	JS_AddModuleExport(ctx, m, "CharInfo");
+	JS_AddModuleExport(ctx, m, "Vector2Array");
+	JS_AddModuleExport(ctx, m, "Vector3Array");
+	JS_AddModuleExport(ctx, m, "ColorArray");
+	JS_AddModuleExport(ctx, m, "DisplayList");
 }
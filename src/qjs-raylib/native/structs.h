@@ -5,17 +5,26 @@
 #include "quickjs/cutils.h"
 #include "raylib.h"
 
+#include "pool.h"
+
+#define JS_ATOM_length 48
+
 #pragma region Image
 
+// Image objects either own their image or view the image of another object
+// (CharInfo.image), which they keep alive in `owner` and leave for it to
+// unload. The image stays first so the opaque can still be read as an Image*.
+typedef struct JSRLImage
+{
+	Image image;
+	JSValue owner;
+} JSRLImage;
+
 JSClassID js_rl_image_class_id;
 
-void js_rl_init_image_class(JSContext* ctx, JSModuleDef* m);
 void js_rl_image_finalizer(JSRuntime* rt, JSValue val);
-
-JSValue js_rl_image_get_width(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_image_get_height(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_image_get_format(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_image_get_mipmaps(JSContext* ctx, JSValueConst this_val);
+JSValue js_rl_new_image(JSContext* ctx, Image image);
+JSValue js_rl_new_image_view(JSContext* ctx, Image image, JSValueConst owner);
 
 #pragma endregion
 #pragma region Vector2
@@ -25,29 +34,17 @@ JSClassID js_rl_vector2_class_id;
 JSValue js_rl_new_vector2(JSContext* ctx, double x, double y);
 JSValue js_rl_vector2_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_vector2_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_vector2_get_x(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector2_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_vector2_get_y(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector2_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_vector2_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Vector3
 
 JSClassID js_rl_vector3_class_id;
 
-JSValue js_rl_new_vector3(JSContext* ctx, int x, int y, int z);
+JSValue js_rl_new_vector3(JSContext* ctx, double x, double y, double z);
 JSValue js_rl_vector3_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_vector3_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_vector3_get_x(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector3_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_vector3_get_y(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector3_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_vector3_get_z(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector3_set_z(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_vector3_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Vector4
@@ -57,16 +54,7 @@ JSClassID js_rl_vector4_class_id;
 JSValue js_rl_new_vector4(JSContext* ctx, double x, double y, double z, double w);
 JSValue js_rl_vector4_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_vector4_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_vector4_get_x(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector4_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_vector4_get_y(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector4_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_vector4_get_z(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector4_set_z(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_vector4_get_w(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_vector4_set_w(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_vector4_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Camera2D
@@ -76,16 +64,7 @@ JSClassID js_rl_camera2d_class_id;
 JSValue js_rl_new_camera2d(JSContext* ctx, Vector2 offset, Vector2 target, double rotation, double zoom);
 JSValue js_rl_camera2d_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_camera2d_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_camera2d_get_offset(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera2d_set_offset(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera2d_get_target(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera2d_set_target(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera2d_get_rotation(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera2d_set_rotation(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera2d_get_zoom(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera2d_set_zoom(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_camera2d_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Camera3D
@@ -95,32 +74,24 @@ JSClassID js_rl_camera3d_class_id;
 JSValue js_rl_new_camera3d(JSContext* ctx, Vector3 position, Vector3 target, Vector3 up, double fovy, int type);
 JSValue js_rl_camera3d_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_camera3d_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_camera3d_get_position(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera3d_set_position(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera3d_get_target(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera3d_set_target(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera3d_get_up(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera3d_set_up(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera3d_get_fov_y(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera3d_set_fov_y(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_camera3d_get_type(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_camera3d_set_type(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_camera3d_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Texture2D
 
+// Same as JSRLImage, views are the attachments of a RenderTexture2D and the
+// atlas of a Font
+typedef struct JSRLTexture
+{
+	Texture2D texture;
+	JSValue owner;
+} JSRLTexture;
+
 JSClassID js_rl_texture2d_class_id;
 
-void js_rl_init_texture2d_class(JSContext* ctx, JSModuleDef* m);
 void js_rl_texture2d_finalizer(JSRuntime* rt, JSValue val);
-
-JSValue js_rl_texture2d_get_id(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_texture2d_get_width(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_texture2d_get_height(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_texture2d_get_format(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_texture2d_get_mipmaps(JSContext* ctx, JSValueConst this_val);
+JSValue js_rl_new_texture(JSContext* ctx, Texture2D texture);
+JSValue js_rl_new_texture_view(JSContext* ctx, Texture2D texture, JSValueConst owner);
 
 #pragma endregion
 #pragma region RenderTexture
@@ -129,18 +100,8 @@ JSClassID js_rl_render_texture_class_id;
 
 JSValue js_rl_render_texture_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_render_texture_class(JSContext* ctx, JSModuleDef* m);
 void js_rl_render_texture_finalizer(JSRuntime* rt, JSValue val);
 
-JSValue js_rl_render_texture_get_id(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_render_texture_set_id(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_render_texture_get_texture(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_render_texture_set_texture(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_render_texture_get_depth(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_render_texture_set_depth(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_render_texture_get_depth_texture(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_render_texture_set_depth_texture(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-
 #pragma endregion
 #pragma region Ray
 
@@ -149,12 +110,7 @@ JSClassID js_rl_ray_class_id;
 JSValue js_rl_new_ray(JSContext* ctx, Vector3 position, Vector3 direction);
 JSValue js_rl_ray_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_ray_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_ray_get_position(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_ray_set_position(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_ray_get_direction(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_ray_set_direction(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_ray_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Matrix
@@ -164,41 +120,7 @@ JSClassID js_rl_matrix_class_id;
 JSValue js_rl_new_matrix(JSContext* ctx, double m0, double m1, double m2, double m3, double m4, double m5, double m6, double m7, double m8, double m9, double m10, double m11, double m12, double m13, double m14, double m15);
 JSValue js_rl_matrix_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_matrix_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_matrix_get_m0(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m1(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m2(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m3(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m4(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m5(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m6(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m7(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m8(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m9(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m10(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m11(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m12(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m13(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m14(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_matrix_get_m15(JSContext* ctx, JSValueConst this_val);
-
-JSValue js_rl_matrix_set_m0(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m1(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m2(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m3(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m4(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m5(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m6(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m7(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m8(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m9(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m10(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m11(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m12(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m13(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m14(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_matrix_set_m15(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_matrix_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Color
@@ -208,16 +130,7 @@ JSClassID js_rl_color_class_id;
 JSValue js_rl_new_color(JSContext* ctx, int r, int g, int b, int a);
 JSValue js_rl_color_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_color_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_color_get_r(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_color_set_r(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_color_get_g(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_color_set_g(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_color_get_b(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_color_set_b(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_color_get_a(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_color_set_a(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_color_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region Rectangle
@@ -227,41 +140,146 @@ JSClassID js_rl_rectangle_class_id;
 JSValue js_rl_new_rectangle(JSContext* ctx, double x, double y, double w, double h);
 JSValue js_rl_rectangle_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
 
-void js_rl_init_rectangle_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_rectangle_get_x(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_rectangle_set_x(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_rectangle_get_y(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_rectangle_set_y(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_rectangle_get_width(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_rectangle_set_width(JSContext* ctx, JSValueConst this_val, JSValueConst v);
-JSValue js_rl_rectangle_get_height(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_rectangle_set_height(JSContext* ctx, JSValueConst this_val, JSValueConst v);
+void js_rl_rectangle_finalizer(JSRuntime* rt, JSValue val);
 
 #pragma endregion
 #pragma region CharInfo
 
 JSClassID js_rl_char_info_class_id;
 
-void js_rl_init_char_info_class(JSContext* ctx, JSModuleDef* m);
-
-JSValue js_rl_char_info_get_value(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_char_info_get_offset_x(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_char_info_get_offset_y(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_char_info_get_advance_x(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_char_info_get_image(JSContext* ctx, JSValueConst this_val);
+void js_rl_char_info_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_char_info(JSContext* ctx, CharInfo character);
 
 #pragma endregion
 #pragma region Font
 
+// Floats per glyph in Font.glyphMetrics: value, offsetX, offsetY, advanceX and the atlas rectangle
+#define JS_RL_GLYPH_METRICS_FLOATS 8
+
+// Font objects keep their glyph metrics view next to the font, which stays
+// first so the opaque can still be read as a Font*. Like JSRLTexture, a font
+// with an `owner` is a view and isn't unloaded with the object; raylib's
+// default font is viewed with a null owner since raylib unloads it itself.
+typedef struct JSRLFont
+{
+	Font font;
+	JSValue glyph_metrics;
+	JSValue owner;
+} JSRLFont;
+
 JSClassID js_rl_font_class_id;
 
-void js_rl_init_font_class(JSContext* ctx, JSModuleDef* m);
 void js_rl_font_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_font(JSContext* ctx, Font font);
+JSValue js_rl_new_font_view(JSContext* ctx, Font font, JSValueConst owner);
 
-JSValue js_rl_font_get_texture(JSContext* ctx, JSValueConst this_val);
-JSValue js_rl_font_get_base_size(JSContext* ctx, JSValueConst this_val);
 JSValue js_rl_font_get_chars(JSContext* ctx, JSValueConst this_val);
+JSValue js_rl_font_get_glyph_metrics(JSContext* ctx, JSValueConst this_val);
+
+#pragma endregion
+#pragma region Shader
+
+JSClassID js_rl_shader_class_id;
+
+void js_rl_shader_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_shader(JSContext* ctx, Shader shader);
+
+#pragma endregion
+#pragma region Mesh
+
+JSClassID js_rl_mesh_class_id;
+
+void js_rl_mesh_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_mesh(JSContext* ctx, Mesh mesh);
+
+#pragma endregion
+#pragma region Model
+
+JSClassID js_rl_model_class_id;
+
+void js_rl_model_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_model(JSContext* ctx, Model model);
+
+#pragma endregion
+#pragma region Wave
+
+JSClassID js_rl_wave_class_id;
+
+void js_rl_wave_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_wave(JSContext* ctx, Wave wave);
+
+#pragma endregion
+#pragma region Sound
+
+JSClassID js_rl_sound_class_id;
+
+void js_rl_sound_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_sound(JSContext* ctx, Sound sound);
+
+#pragma endregion
+#pragma region AudioStream
+
+JSClassID js_rl_audio_stream_class_id;
+
+void js_rl_audio_stream_finalizer(JSRuntime* rt, JSValue val);
+JSValue js_rl_new_audio_stream(JSContext* ctx, AudioStream stream);
+
+#pragma endregion
+
+#pragma region Buffers
+
+JSValue js_rl_new_array_buffer(JSContext* ctx, size_t size);
+JSValue js_rl_wrap_raylib_buffer(JSContext* ctx, void* data, size_t size);
+JSValue js_rl_new_typed_array(JSContext* ctx, const char* type, JSValueConst buffer, size_t offset, size_t length);
+// 1 when val is an instance of the global typed array constructor `type`, 0
+// when it isn't, -1 with an exception pending
+int js_rl_is_typed_array(JSContext* ctx, JSValueConst val, const char* type);
+uint8_t* js_rl_get_array_buffer(JSContext* ctx, JSValueConst val, size_t* size);
+
+#pragma endregion
+#pragma region Struct arrays
+
+// Packed arrays of raylib structs living in an ArrayBuffer
+typedef struct JSRLStructArray
+{
+	JSValue buffer;
+	JSValue view;
+	size_t offset;
+	size_t element_size;
+	uint32_t length;
+} JSRLStructArray;
+
+JSClassID js_rl_vector2_array_class_id;
+JSClassID js_rl_vector3_array_class_id;
+JSClassID js_rl_color_array_class_id;
+
+void* js_rl_get_struct_array(JSContext* ctx, JSValueConst val, JSClassID class_id, uint32_t* length);
+
+JSValue js_rl_vector2_array_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
+JSValue js_rl_vector3_array_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
+JSValue js_rl_color_array_constructor(JSContext* ctx, JSValueConst new_target, int argc, JSValueConst *argv);
+
+void js_rl_init_vector2_array_class(JSContext* ctx, JSModuleDef* m);
+void js_rl_init_vector3_array_class(JSContext* ctx, JSModuleDef* m);
+void js_rl_init_color_array_class(JSContext* ctx, JSModuleDef* m);
+void js_rl_vector2_array_finalizer(JSRuntime* rt, JSValue val);
+void js_rl_vector3_array_finalizer(JSRuntime* rt, JSValue val);
+void js_rl_color_array_finalizer(JSRuntime* rt, JSValue val);
+
+JSValue js_rl_struct_array_get_length(JSContext* ctx, JSValueConst this_val, int magic);
+JSValue js_rl_struct_array_get_buffer(JSContext* ctx, JSValueConst this_val, int magic);
+JSValue js_rl_struct_array_get_data(JSContext* ctx, JSValueConst this_val, int magic);
+JSValue js_rl_struct_array_get(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic);
+JSValue js_rl_struct_array_set(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic);
+
+#pragma endregion
+#pragma region Struct results
+
+JSValue js_rl_new_struct(JSContext* ctx, JSRLPoolKind kind, const void* value);
+// Returns `value` written into the optional destination argv[index], or in a new object when there is none
+JSValue js_rl_return_struct(JSContext* ctx, JSRLPoolKind kind, const void* value, int argc, JSValueConst* argv, int index);
+
+JSValue js_rl_persist(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
 
 #pragma endregion
 
@@ -0,0 +1,353 @@
+#include "textcache.h"
+#include "args.h"
+
+#pragma region Text layout cache
+
+// Layouts hold no JS values and fonts belong to the single raylib window, so
+// the cache is shared by every runtime. The LRU list runs from the most
+// recently used layout (head) to the next one to evict (tail).
+static struct
+{
+	JSRLTextLayout* buckets[JS_RL_TEXT_LAYOUT_BUCKETS];
+	JSRLTextLayout* head;
+	JSRLTextLayout* tail;
+	uint32_t count;
+	uint32_t capacity;
+	int64_t hits;
+	int64_t misses;
+	int64_t evictions;
+	int64_t bytes;
+} js_rl_text_layouts = { .capacity = JS_RL_TEXT_LAYOUT_DEFAULT_CAPACITY };
+
+// Same decoding as raylib: invalid sequences yield '?' and consume one byte
+int js_rl_next_codepoint(const uint8_t* s, size_t left, int* bytes)
+{
+	int n, codepoint;
+
+	*bytes = 1;
+
+	if (s[0] < 0x80)
+		return s[0];
+	else if ((s[0] & 0xe0) == 0xc0)
+	{
+		n = 2;
+		codepoint = s[0] & 0x1f;
+	}
+	else if ((s[0] & 0xf0) == 0xe0)
+	{
+		n = 3;
+		codepoint = s[0] & 0x0f;
+	}
+	else if ((s[0] & 0xf8) == 0xf0)
+	{
+		n = 4;
+		codepoint = s[0] & 0x07;
+	}
+	else
+		return '?';
+
+	if ((size_t)n > left)
+		return '?';
+
+	for (int i = 1; i < n; i++)
+	{
+		if ((s[i] & 0xc0) != 0x80)
+			return '?';
+
+		codepoint = (codepoint << 6) | (s[i] & 0x3f);
+	}
+
+	*bytes = n;
+
+	return codepoint;
+}
+
+static uint32_t js_rl_text_layout_hash(Font font, const char* text, size_t length, float fontSize, float spacing)
+{
+	// FNV-1a over the text, then the font and metrics
+	uint32_t h = 2166136261u;
+
+	for (size_t i = 0; i < length; i++)
+		h = (h ^ (uint8_t)text[i]) * 16777619u;
+
+	uint32_t size_bits, spacing_bits;
+	memcpy(&size_bits, &fontSize, sizeof(float));
+	memcpy(&spacing_bits, &spacing, sizeof(float));
+
+	h = (h ^ font.texture.id) * 16777619u;
+	h = (h ^ (uint32_t)((uintptr_t)font.chars >> 4)) * 16777619u;
+	h = (h ^ size_bits) * 16777619u;
+	h = (h ^ spacing_bits) * 16777619u;
+
+	return h;
+}
+
+static void js_rl_text_layout_unlink(JSRLTextLayout* layout)
+{
+	if (layout->prev)
+		layout->prev->next = layout->next;
+	else
+		js_rl_text_layouts.head = layout->next;
+
+	if (layout->next)
+		layout->next->prev = layout->prev;
+	else
+		js_rl_text_layouts.tail = layout->prev;
+
+	layout->prev = layout->next = NULL;
+}
+
+static void js_rl_text_layout_push_front(JSRLTextLayout* layout)
+{
+	layout->prev = NULL;
+	layout->next = js_rl_text_layouts.head;
+
+	if (layout->next)
+		layout->next->prev = layout;
+	else
+		js_rl_text_layouts.tail = layout;
+
+	js_rl_text_layouts.head = layout;
+}
+
+static size_t js_rl_text_layout_bytes(const JSRLTextLayout* layout)
+{
+	return sizeof(JSRLTextLayout) + strnlen(layout->text, layout->length) * sizeof(JSRLGlyphQuad) + layout->length + 1;
+}
+
+static void js_rl_text_layout_free(JSRLTextLayout* layout)
+{
+	JSRLTextLayout** link = &js_rl_text_layouts.buckets[layout->hash & (JS_RL_TEXT_LAYOUT_BUCKETS - 1)];
+
+	while (*link != layout)
+		link = &(*link)->chain;
+
+	*link = layout->chain;
+
+	js_rl_text_layout_unlink(layout);
+	js_rl_text_layouts.count--;
+	js_rl_text_layouts.bytes -= js_rl_text_layout_bytes(layout);
+
+	// Quads and text share the layout allocation
+	free(layout);
+}
+
+// Mirrors DrawTextEx and MeasureTextEx: the first places the quads (only when
+// quads is given), the second sizes the text from unscaled advances
+static Vector2 js_rl_layout_text(Font font, const char* text, size_t length, float fontSize, float spacing, JSRLGlyphQuad* quads, uint32_t* quad_count)
+{
+	float scale = fontSize / font.baseSize;
+	float x = 0.0f, width = 0.0f, max_width = 0.0f;
+	float height = (float)font.baseSize;
+	int y = 0, line_count = 0, max_count = 0;
+	uint32_t count = 0;
+
+	for (size_t i = 0; i < length;)
+	{
+		int bytes;
+		int codepoint = js_rl_next_codepoint((const uint8_t*)text + i, length - i, &bytes);
+		int index = GetGlyphIndex(font, codepoint);
+
+		i += bytes;
+		line_count++;
+
+		if (codepoint == '\n')
+		{
+			y += (int)((font.baseSize + font.baseSize / 2) * scale);
+			x = 0.0f;
+
+			if (max_width < width)
+				max_width = width;
+
+			line_count = 0;
+			width = 0.0f;
+			height += (float)font.baseSize * 1.5f;
+		}
+		else
+		{
+			CharInfo* glyph = &font.chars[index];
+			Rectangle rec = font.recs[index];
+
+			if (quads && codepoint != ' ' && codepoint != '\t')
+			{
+				JSRLGlyphQuad* quad = &quads[count++];
+				quad->source = rec;
+				quad->dest = (Rectangle){ x + glyph->offsetX * scale, y + glyph->offsetY * scale, rec.width * scale, rec.height * scale };
+			}
+
+			if (glyph->advanceX == 0)
+			{
+				x += rec.width * scale + spacing;
+				width += rec.width + glyph->offsetX;
+			}
+			else
+			{
+				x += glyph->advanceX * scale + spacing;
+				width += glyph->advanceX;
+			}
+		}
+
+		if (max_count < line_count)
+			max_count = line_count;
+	}
+
+	if (max_width < width)
+		max_width = width;
+
+	if (quad_count)
+		*quad_count = count;
+
+	return (Vector2){ max_width * scale + (max_count - 1) * spacing, height * scale };
+}
+
+static JSRLTextLayout* js_rl_build_text_layout(Font font, const char* text, size_t length, float fontSize, float spacing, uint32_t hash)
+{
+	// raylib stops at the first NUL, and every glyph takes at least one byte
+	size_t text_length = strnlen(text, length);
+	JSRLTextLayout* layout = malloc(sizeof(JSRLTextLayout) + text_length * sizeof(JSRLGlyphQuad) + length + 1);
+
+	if (!layout)
+		return NULL;
+
+	memset(layout, 0, sizeof(JSRLTextLayout));
+	layout->quads = (JSRLGlyphQuad*)(layout + 1);
+	layout->text = (char*)(layout->quads + text_length);
+	memcpy(layout->text, text, length);
+	layout->text[length] = '\0';
+	layout->length = length;
+	layout->hash = hash;
+	layout->texture = font.texture.id;
+	layout->chars = font.chars;
+	layout->font_size = fontSize;
+	layout->spacing = spacing;
+	layout->size = js_rl_layout_text(font, text, text_length, fontSize, spacing, layout->quads, &layout->quad_count);
+
+	return layout;
+}
+
+Vector2 js_rl_measure_text_utf8(Font font, const char* text, size_t length, float fontSize, float spacing)
+{
+	if (font.baseSize == 0)
+		return (Vector2){ 0.0f, 0.0f };
+
+	return js_rl_layout_text(font, text, strnlen(text, length), fontSize, spacing, NULL, NULL);
+}
+
+const JSRLTextLayout* js_rl_get_text_layout(Font font, const char* text, size_t length, float fontSize, float spacing)
+{
+	if (js_rl_text_layouts.capacity == 0 || length > JS_RL_TEXT_LAYOUT_MAX_LENGTH || font.baseSize == 0)
+		return NULL;
+
+	uint32_t hash = js_rl_text_layout_hash(font, text, length, fontSize, spacing);
+	JSRLTextLayout** bucket = &js_rl_text_layouts.buckets[hash & (JS_RL_TEXT_LAYOUT_BUCKETS - 1)];
+
+	for (JSRLTextLayout* layout = *bucket; layout; layout = layout->chain)
+	{
+		if (layout->hash == hash && layout->texture == font.texture.id && layout->chars == font.chars &&
+			layout->font_size == fontSize && layout->spacing == spacing &&
+			layout->length == length && memcmp(layout->text, text, length) == 0)
+		{
+			js_rl_text_layouts.hits++;
+
+			if (js_rl_text_layouts.head != layout)
+			{
+				js_rl_text_layout_unlink(layout);
+				js_rl_text_layout_push_front(layout);
+			}
+
+			return layout;
+		}
+	}
+
+	js_rl_text_layouts.misses++;
+
+	JSRLTextLayout* layout = js_rl_build_text_layout(font, text, length, fontSize, spacing, hash);
+
+	if (!layout)
+		return NULL;
+
+	while (js_rl_text_layouts.count >= js_rl_text_layouts.capacity)
+	{
+		js_rl_text_layout_free(js_rl_text_layouts.tail);
+		js_rl_text_layouts.evictions++;
+	}
+
+	layout->chain = *bucket;
+	*bucket = layout;
+	js_rl_text_layout_push_front(layout);
+	js_rl_text_layouts.count++;
+	js_rl_text_layouts.bytes += js_rl_text_layout_bytes(layout);
+
+	return layout;
+}
+
+void js_rl_draw_text_layout(Font font, const JSRLTextLayout* layout, Vector2 position, Color tint)
+{
+	for (uint32_t i = 0; i < layout->quad_count; i++)
+	{
+		const JSRLGlyphQuad* quad = &layout->quads[i];
+		Rectangle dest = { position.x + quad->dest.x, position.y + quad->dest.y, quad->dest.width, quad->dest.height };
+
+		DrawTexturePro(font.texture, quad->source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, tint);
+	}
+}
+
+void js_rl_forget_font_layouts(Font font)
+{
+	JSRLTextLayout* layout = js_rl_text_layouts.head;
+
+	while (layout)
+	{
+		JSRLTextLayout* next = layout->next;
+
+		if (layout->texture == font.texture.id || layout->chars == font.chars)
+			js_rl_text_layout_free(layout);
+
+		layout = next;
+	}
+}
+
+void js_rl_clear_text_layouts(void)
+{
+	while (js_rl_text_layouts.head)
+		js_rl_text_layout_free(js_rl_text_layouts.head);
+}
+
+JSValue js_rl_set_text_layout_cache_size(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	uint32_t capacity;
+
+	if (JS_RL_TO_UINT32(ctx, &capacity, argv[0]))
+		return JS_EXCEPTION;
+
+	js_rl_text_layouts.capacity = capacity;
+
+	while (js_rl_text_layouts.count > capacity)
+	{
+		js_rl_text_layout_free(js_rl_text_layouts.tail);
+		js_rl_text_layouts.evictions++;
+	}
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_get_text_layout_cache_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	int64_t lookups = js_rl_text_layouts.hits + js_rl_text_layouts.misses;
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "entries", JS_NewUint32(ctx, js_rl_text_layouts.count));
+	JS_SetPropertyStr(ctx, obj, "capacity", JS_NewUint32(ctx, js_rl_text_layouts.capacity));
+	JS_SetPropertyStr(ctx, obj, "hits", JS_NewInt64(ctx, js_rl_text_layouts.hits));
+	JS_SetPropertyStr(ctx, obj, "misses", JS_NewInt64(ctx, js_rl_text_layouts.misses));
+	JS_SetPropertyStr(ctx, obj, "evictions", JS_NewInt64(ctx, js_rl_text_layouts.evictions));
+	JS_SetPropertyStr(ctx, obj, "bytes", JS_NewInt64(ctx, js_rl_text_layouts.bytes));
+	JS_SetPropertyStr(ctx, obj, "hitRate", JS_NewFloat64(ctx, lookups ? (double)js_rl_text_layouts.hits / lookups : 0));
+
+	return obj;
+}
+
+#pragma endregion
@@ -0,0 +1,60 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+#include "raylib.h"
+
+#pragma region Text layout cache
+
+#define JS_RL_TEXT_LAYOUT_BUCKETS 1024
+#define JS_RL_TEXT_LAYOUT_DEFAULT_CAPACITY 256
+// Longer strings are unlikely to repeat and are drawn without caching
+#define JS_RL_TEXT_LAYOUT_MAX_LENGTH 1024
+
+typedef struct JSRLGlyphQuad
+{
+	Rectangle source;
+	// Relative to the text position
+	Rectangle dest;
+} JSRLGlyphQuad;
+
+typedef struct JSRLTextLayout
+{
+	struct JSRLTextLayout* prev;
+	struct JSRLTextLayout* next;
+	struct JSRLTextLayout* chain;
+	uint32_t hash;
+	// A font is identified by its atlas and glyph table
+	unsigned int texture;
+	const CharInfo* chars;
+	float font_size;
+	float spacing;
+	// Same result as MeasureTextEx
+	Vector2 size;
+	uint32_t quad_count;
+	JSRLGlyphQuad* quads;
+	size_t length;
+	char* text;
+} JSRLTextLayout;
+
+// Returns the layout of text, building it on a miss. The layout stays valid
+// until the next lookup. NULL means the text can't be cached (too long, cache
+// disabled or out of memory) and the caller should fall back to raylib.
+const JSRLTextLayout* js_rl_get_text_layout(Font font, const char* text, size_t length, float fontSize, float spacing);
+// Measures like MeasureTextEx without going through the cache
+Vector2 js_rl_measure_text_utf8(Font font, const char* text, size_t length, float fontSize, float spacing);
+void js_rl_draw_text_layout(Font font, const JSRLTextLayout* layout, Vector2 position, Color tint);
+void js_rl_forget_font_layouts(Font font);
+// Drops every layout. The GL context goes away with the window, so a font
+// loaded after the next InitWindow can reuse a texture id and glyph table
+// address of a font layouts were built for.
+void js_rl_clear_text_layouts(void);
+
+// Decodes the codepoint at s like raylib's GetNextCodepoint, left bounds the read
+int js_rl_next_codepoint(const uint8_t* s, size_t left, int* bytes);
+
+JSValue js_rl_set_text_layout_cache_size(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_text_layout_cache_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion
@@ -0,0 +1,397 @@
+#include "stdlib.h"
+#include "time.h"
+#include "pthread.h"
+
+#include "trace.h"
+#include "strcache.h"
+
+#pragma region Tracing
+
+typedef struct JSRLTraceEvent
+{
+	// Microseconds, see js_rl_trace_now()
+	double ts;
+	double dur;
+	// Chrome trace-event phase: 'B', 'E', 'X' or 'i'
+	char ph;
+	uint8_t category;
+	char name[JS_RL_TRACE_NAME_LENGTH];
+} JSRLTraceEvent;
+
+typedef struct JSRLTraceChunk
+{
+	struct JSRLTraceChunk* next;
+	uint32_t count;
+	JSRLTraceEvent events[JS_RL_TRACE_CHUNK_EVENTS];
+} JSRLTraceChunk;
+
+// The main thread fills current and queues it once full, the writer thread
+// turns queued chunks into JSON. Only the queue is shared between them.
+static struct
+{
+	BOOL active;
+	JSRLTraceChunk* current;
+	int64_t events;
+	int64_t dropped;
+	pthread_t writer;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	JSRLTraceChunk* head;
+	JSRLTraceChunk* tail;
+	BOOL stopping;
+	// Owned by the writer thread while tracing
+	FILE* file;
+	BOOL first;
+	// Events written so far, shared
+	int64_t written;
+} js_rl_trace = { .lock = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER };
+
+static const char* js_rl_trace_categories[] = { "binding", "frame", "script" };
+
+BOOL js_rl_tracing(void)
+{
+	return js_rl_trace.active;
+}
+
+double js_rl_trace_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void js_rl_trace_write_string(FILE* file, const char* s)
+{
+	fputc('"', file);
+
+	for (; *s; s++)
+	{
+		unsigned char c = *s;
+
+		if (c == '"' || c == '\\')
+			fprintf(file, "\\%c", c);
+		else if (c < 0x20)
+			fprintf(file, "\\u%04x", c);
+		else
+			fputc(c, file);
+	}
+
+	fputc('"', file);
+}
+
+static void js_rl_trace_write_chunk(const JSRLTraceChunk* chunk)
+{
+	FILE* file = js_rl_trace.file;
+
+	for (uint32_t i = 0; i < chunk->count; i++)
+	{
+		const JSRLTraceEvent* event = &chunk->events[i];
+
+		fputs(js_rl_trace.first ? "\n" : ",\n", file);
+		js_rl_trace.first = FALSE;
+
+		fprintf(file, "{\"ph\":\"%c\",\"cat\":\"%s\",\"pid\":1,\"tid\":1,\"ts\":%.3f", event->ph, js_rl_trace_categories[event->category], event->ts);
+
+		if (event->ph == 'X')
+			fprintf(file, ",\"dur\":%.3f", event->dur);
+		else if (event->ph == 'i')
+			fputs(",\"s\":\"t\"", file);
+
+		if (event->ph != 'E')
+		{
+			fputs(",\"name\":", file);
+			js_rl_trace_write_string(file, event->name);
+		}
+
+		fputc('}', file);
+	}
+}
+
+static void* js_rl_trace_writer(void* arg)
+{
+	for (;;)
+	{
+		pthread_mutex_lock(&js_rl_trace.lock);
+
+		while (!js_rl_trace.head && !js_rl_trace.stopping)
+			pthread_cond_wait(&js_rl_trace.cond, &js_rl_trace.lock);
+
+		JSRLTraceChunk* chunk = js_rl_trace.head;
+
+		if (chunk)
+		{
+			js_rl_trace.head = chunk->next;
+
+			if (!js_rl_trace.head)
+				js_rl_trace.tail = NULL;
+		}
+
+		pthread_mutex_unlock(&js_rl_trace.lock);
+
+		// Stopping only ends the thread once the queue is drained
+		if (!chunk)
+			break;
+
+		js_rl_trace_write_chunk(chunk);
+
+		pthread_mutex_lock(&js_rl_trace.lock);
+		js_rl_trace.written += chunk->count;
+		pthread_mutex_unlock(&js_rl_trace.lock);
+
+		free(chunk);
+	}
+
+	return NULL;
+}
+
+static void js_rl_trace_submit(void)
+{
+	JSRLTraceChunk* chunk = js_rl_trace.current;
+
+	if (!chunk)
+		return;
+
+	js_rl_trace.current = NULL;
+	chunk->next = NULL;
+
+	pthread_mutex_lock(&js_rl_trace.lock);
+
+	if (js_rl_trace.tail)
+		js_rl_trace.tail->next = chunk;
+	else
+		js_rl_trace.head = chunk;
+
+	js_rl_trace.tail = chunk;
+	pthread_cond_signal(&js_rl_trace.cond);
+	pthread_mutex_unlock(&js_rl_trace.lock);
+}
+
+static JSRLTraceEvent* js_rl_trace_push(JSRLTraceCategory category, char ph, const char* name)
+{
+	if (js_rl_trace.current && js_rl_trace.current->count == JS_RL_TRACE_CHUNK_EVENTS)
+		js_rl_trace_submit();
+
+	if (!js_rl_trace.current)
+	{
+		js_rl_trace.current = malloc(sizeof(JSRLTraceChunk));
+
+		if (!js_rl_trace.current)
+		{
+			js_rl_trace.dropped++;
+			return NULL;
+		}
+
+		js_rl_trace.current->count = 0;
+	}
+
+	JSRLTraceEvent* event = &js_rl_trace.current->events[js_rl_trace.current->count++];
+	size_t length = name ? strnlen(name, JS_RL_TRACE_NAME_LENGTH - 1) : 0;
+
+	// Don't cut a truncated name in the middle of a UTF-8 sequence
+	if (length == JS_RL_TRACE_NAME_LENGTH - 1)
+	{
+		while (length > 0 && ((uint8_t)name[length] & 0xc0) == 0x80)
+			length--;
+	}
+
+	event->ph = ph;
+	event->category = category;
+
+	if (length)
+		memcpy(event->name, name, length);
+
+	event->name[length] = '\0';
+	js_rl_trace.events++;
+
+	return event;
+}
+
+void js_rl_trace_begin(JSRLTraceCategory category, const char* name)
+{
+	if (!js_rl_trace.active)
+		return;
+
+	JSRLTraceEvent* event = js_rl_trace_push(category, 'B', name);
+
+	if (event)
+		event->ts = js_rl_trace_now();
+}
+
+void js_rl_trace_end(JSRLTraceCategory category)
+{
+	if (!js_rl_trace.active)
+		return;
+
+	// Read the clock first so the end isn't delayed by the push
+	double now = js_rl_trace_now();
+	JSRLTraceEvent* event = js_rl_trace_push(category, 'E', NULL);
+
+	if (event)
+		event->ts = now;
+}
+
+void js_rl_trace_instant(JSRLTraceCategory category, const char* name)
+{
+	if (!js_rl_trace.active)
+		return;
+
+	JSRLTraceEvent* event = js_rl_trace_push(category, 'i', name);
+
+	if (event)
+		event->ts = js_rl_trace_now();
+}
+
+void js_rl_trace_complete(JSRLTraceCategory category, const char* name, double start, double end)
+{
+	if (!js_rl_trace.active)
+		return;
+
+	JSRLTraceEvent* event = js_rl_trace_push(category, 'X', name);
+
+	if (event)
+	{
+		event->ts = start;
+		event->dur = end - start;
+	}
+}
+
+// Returns FALSE when the trace couldn't be written completely
+static BOOL js_rl_trace_stop(void)
+{
+	js_rl_trace_submit();
+
+	pthread_mutex_lock(&js_rl_trace.lock);
+	js_rl_trace.stopping = TRUE;
+	pthread_cond_signal(&js_rl_trace.cond);
+	pthread_mutex_unlock(&js_rl_trace.lock);
+
+	pthread_join(js_rl_trace.writer, NULL);
+
+	fputs("\n]}\n", js_rl_trace.file);
+
+	BOOL ok = !ferror(js_rl_trace.file);
+
+	if (fclose(js_rl_trace.file) != 0)
+		ok = FALSE;
+
+	js_rl_trace.file = NULL;
+	js_rl_trace.active = FALSE;
+	js_rl_trace.stopping = FALSE;
+
+	return ok;
+}
+
+void js_rl_trace_close(void)
+{
+	if (js_rl_trace.active)
+		js_rl_trace_stop();
+}
+
+JSValue js_rl_start_trace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	const char* fileName = "trace.json";
+
+	if (js_rl_trace.active)
+		return JS_ThrowInternalError(ctx, "a trace is already being recorded");
+
+	if (argc > 0 && !JS_IsUndefined(argv[0]))
+	{
+		fileName = js_rl_get_cached_string(ctx, argv[0]);
+
+		if (!fileName)
+			return JS_EXCEPTION;
+	}
+
+	FILE* file = fopen(fileName, "w");
+
+	if (!file)
+		return JS_ThrowInternalError(ctx, "cannot open trace file %s", fileName);
+
+	fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+
+	js_rl_trace.file = file;
+	js_rl_trace.first = TRUE;
+	js_rl_trace.events = 0;
+	js_rl_trace.dropped = 0;
+	js_rl_trace.written = 0;
+
+	if (pthread_create(&js_rl_trace.writer, NULL, js_rl_trace_writer, NULL) != 0)
+	{
+		fclose(file);
+		js_rl_trace.file = NULL;
+		return JS_ThrowInternalError(ctx, "cannot start the trace writer");
+	}
+
+	js_rl_trace.active = TRUE;
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_stop_trace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (!js_rl_trace.active)
+		return JS_ThrowInternalError(ctx, "no trace is being recorded");
+
+	if (!js_rl_trace_stop())
+		return JS_ThrowInternalError(ctx, "cannot write the trace file");
+
+	return JS_NewInt64(ctx, js_rl_trace.written);
+}
+
+JSValue js_rl_begin_trace_span(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (!js_rl_trace.active)
+		return JS_UNDEFINED;
+
+	const char* name = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (!name)
+		return JS_EXCEPTION;
+
+	js_rl_trace_begin(JS_RL_TRACE_SCRIPT, name);
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_end_trace_span(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	js_rl_trace_end(JS_RL_TRACE_SCRIPT);
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_add_trace_instant(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	if (!js_rl_trace.active)
+		return JS_UNDEFINED;
+
+	const char* name = js_rl_get_cached_string(ctx, argv[0]);
+
+	if (!name)
+		return JS_EXCEPTION;
+
+	js_rl_trace_instant(JS_RL_TRACE_SCRIPT, name);
+
+	return JS_UNDEFINED;
+}
+
+JSValue js_rl_get_trace_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv)
+{
+	pthread_mutex_lock(&js_rl_trace.lock);
+	int64_t written = js_rl_trace.written;
+	pthread_mutex_unlock(&js_rl_trace.lock);
+
+	JSValue obj = JS_NewObject(ctx);
+
+	if (JS_IsException(obj))
+		return obj;
+
+	JS_SetPropertyStr(ctx, obj, "active", JS_NewBool(ctx, js_rl_trace.active));
+	JS_SetPropertyStr(ctx, obj, "events", JS_NewInt64(ctx, js_rl_trace.events));
+	JS_SetPropertyStr(ctx, obj, "written", JS_NewInt64(ctx, written));
+	JS_SetPropertyStr(ctx, obj, "dropped", JS_NewInt64(ctx, js_rl_trace.dropped));
+
+	return obj;
+}
+
+#pragma endregion
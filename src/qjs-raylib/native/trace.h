@@ -0,0 +1,42 @@
+#include "stdio.h"
+#include "string.h"
+
+#include "quickjs/quickjs.h"
+#include "quickjs/cutils.h"
+
+#pragma region Tracing
+
+// Events are buffered in chunks, full chunks are written by a background thread
+#define JS_RL_TRACE_CHUNK_EVENTS 4096
+// Longer span names are truncated
+#define JS_RL_TRACE_NAME_LENGTH 46
+
+typedef enum JSRLTraceCategory
+{
+	// Bindings, when built with JS_RL_TRACE_BINDINGS
+	JS_RL_TRACE_BINDING,
+	// Frame phases, see profiler.h
+	JS_RL_TRACE_FRAME,
+	// Spans emitted by scripts
+	JS_RL_TRACE_SCRIPT,
+} JSRLTraceCategory;
+
+BOOL js_rl_tracing(void);
+// Microseconds on a monotonic clock, the trace timebase
+double js_rl_trace_now(void);
+// Spans on the main thread, begin/end pairs must nest
+void js_rl_trace_begin(JSRLTraceCategory category, const char* name);
+void js_rl_trace_end(JSRLTraceCategory category);
+void js_rl_trace_instant(JSRLTraceCategory category, const char* name);
+void js_rl_trace_complete(JSRLTraceCategory category, const char* name, double start, double end);
+// Flushes and closes the trace file, if any
+void js_rl_trace_close(void);
+
+JSValue js_rl_start_trace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_stop_trace(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_begin_trace_span(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_end_trace_span(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_add_trace_instant(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+JSValue js_rl_get_trace_stats(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv);
+
+#pragma endregion